@@ -1,4 +1,6 @@
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <memory>
 #include <list/list.hpp>
 #include <list/iterators.hpp>
 #include <list/listNode.hpp>
@@ -464,3 +466,98 @@ BOOST_AUTO_TEST_CASE(test_merge)
   list2.sort(is_greater< int >);
   list1.merge(list2, is_greater< int >);
 }
+template< typename T >
+struct CountingAllocator
+{
+  using value_type = T;
+  size_t* live;
+
+  explicit CountingAllocator(size_t& counter) noexcept:
+    live(std::addressof(counter))
+  {}
+  template< typename U >
+  CountingAllocator(const CountingAllocator< U >& other) noexcept:
+    live(other.live)
+  {}
+  T* allocate(size_t n)
+  {
+    ++*live;
+    return std::allocator< T >().allocate(n);
+  }
+  void deallocate(T* ptr, size_t n) noexcept
+  {
+    --*live;
+    std::allocator< T >().deallocate(ptr, n);
+  }
+  template< typename U >
+  bool operator==(const CountingAllocator< U >& rhs) const noexcept
+  {
+    return live == rhs.live;
+  }
+  template< typename U >
+  bool operator!=(const CountingAllocator< U >& rhs) const noexcept
+  {
+    return live != rhs.live;
+  }
+};
+BOOST_AUTO_TEST_CASE(test_node_pool)
+{
+  using list_t = alymova::List< int, CountingAllocator< int > >;
+
+  size_t allocations = 0;
+  CountingAllocator< int > alloc(allocations);
+  {
+    list_t list1(alloc);
+    list1.push_back(1);
+    BOOST_TEST(allocations == 1);
+    list1.push_back(2);
+    BOOST_TEST(allocations == 3);
+    list1.push_back(3);
+    BOOST_TEST(allocations == 3);
+
+    list_t list2(alloc);
+    list2.push_back(4);
+    list1.splice(list1.end(), list2);
+    BOOST_TEST(list2.empty());
+    BOOST_TEST(allocations == 4);
+
+    list_t list3(alloc);
+    list3.push_back(5);
+    list3.splice(list3.begin(), list1, list1.begin(), ++(++list1.begin()));
+    BOOST_TEST(allocations == 5);
+    BOOST_TEST(list1.size() == 2);
+    BOOST_TEST(list3.size() == 3);
+
+    list_t list4(alloc);
+    list4.push_back(6);
+    list_t list5(alloc);
+    list5.push_back(7);
+    list4.splice(list4.end(), list5);
+    BOOST_TEST(allocations == 7);
+    list4.push_back(8);
+    BOOST_TEST(allocations == 9);
+    list3.splice(list3.end(), list4);
+
+    int expected[] = {1, 2, 5, 6, 7, 8};
+    BOOST_TEST(list3.size() == 6);
+    BOOST_TEST(std::equal(list3.begin(), list3.end(), expected));
+    list1.clear();
+    list3.clear();
+    BOOST_TEST(list1.empty());
+    BOOST_TEST(list3.empty());
+  }
+  BOOST_TEST(allocations == 0);
+
+  {
+    list_t list(alloc);
+    for (int i = 0; i < 100; i++)
+    {
+      list.push_back(i);
+    }
+    list.clear();
+    BOOST_TEST(allocations == 1);
+    list.push_back(1);
+    BOOST_TEST(list.front() == 1);
+  }
+  BOOST_TEST(allocations == 0);
+}
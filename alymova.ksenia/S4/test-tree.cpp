@@ -448,3 +448,60 @@ BOOST_AUTO_TEST_CASE(test_erase)
   BOOST_TEST(tree.size() == 0);
   BOOST_TEST((it == tree.end()));
 }
+BOOST_AUTO_TEST_CASE(test_lazy_erase)
+{
+  using Tree = alymova::TwoThreeTree< int, std::string, std::less< int > >;
+  using Iterator = alymova::TTTIterator< int, std::string, std::less< int > >;
+
+  Tree tree;
+  tree.set_lazy_erase(0.5);
+  for (int i = 0; i < 10; i++)
+  {
+    tree.emplace(i, "a");
+  }
+  Iterator it = tree.erase(tree.find(3));
+  BOOST_TEST(tree.size() == 9);
+  BOOST_TEST(it->first == 4);
+  BOOST_TEST(tree.count(3) == 0);
+  BOOST_TEST(tree.erase(0) == 1);
+  BOOST_TEST(tree.begin()->first == 1);
+  BOOST_TEST(tree.erase(9) == 1);
+  BOOST_TEST((--tree.end())->first == 8);
+
+  int sum = 0;
+  for (auto lnr = tree.lnr_cbegin(); lnr != tree.lnr_cend(); ++lnr)
+  {
+    sum += lnr->first;
+  }
+  BOOST_TEST(sum == 33);
+  for (auto rnl = tree.rnl_cbegin(); rnl != tree.rnl_cend(); ++rnl)
+  {
+    sum -= rnl->first;
+  }
+  BOOST_TEST(sum == 0);
+  for (auto breadth = tree.breadth_cbegin(); breadth != tree.breadth_cend(); ++breadth)
+  {
+    sum += breadth->first;
+  }
+  BOOST_TEST(sum == 33);
+
+  BOOST_TEST(tree.insert({3, "b"}).second);
+  BOOST_TEST(tree.at(3) == "b");
+  BOOST_TEST(tree.size() == 8);
+
+  tree.erase(1);
+  tree.erase(2);
+  tree.erase(4);
+  BOOST_TEST(tree.size() == 5);
+  std::string keys;
+  for (auto i = tree.cbegin(); i != tree.cend(); ++i)
+  {
+    keys += std::to_string(i->first);
+  }
+  BOOST_TEST(keys == "35678");
+
+  tree.set_lazy_erase(0);
+  it = tree.erase(tree.find(5));
+  BOOST_TEST(it->first == 6);
+  BOOST_TEST(tree.size() == 4);
+}
@@ -5,7 +5,7 @@
 
 namespace alymova
 {
-  template< typename T >
+  template< typename T, typename Alloc >
   class List;
 
   template< typename T >
@@ -23,7 +23,8 @@ namespace alymova
     T& operator*() noexcept;
     T* operator->() noexcept;
   private:
-    friend class List< T >;
+    template< typename U, typename Alloc >
+    friend class List;
     detail::ListNode< T >* node_;
     Iterator(detail::ListNode< T >* node);
   };
@@ -42,7 +43,8 @@ namespace alymova
     const T& operator*() noexcept;
     const T* operator->() noexcept;
   private:
-    friend class List< T >;
+    template< typename U, typename Alloc >
+    friend class List;
     const detail::ListNode< T >* node_;
     ConstIterator(detail::ListNode< T >* node);
   };
@@ -2,30 +2,36 @@
 #define LIST_HPP
 #include <cassert>
 #include <cstddef>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <initializer_list>
 #include <algorithm>
 #include "iterators.hpp"
+#include "nodePool.hpp"
 
 namespace alymova
 {
-  template< typename T >
+  template< typename T, typename Alloc = std::allocator< T > >
   class List
   {
   public:
+    using allocator_type = Alloc;
+
     List();
-    List(const List< T >& other);
-    List(List< T >&& other) noexcept;
+    explicit List(const Alloc& alloc);
+    List(const List< T, Alloc >& other);
+    List(List< T, Alloc >&& other) noexcept;
     List(size_t n, const T& value = T());
     template< typename InputIterator>
     List(InputIterator first, InputIterator last);
     List(std::initializer_list< T > il);
     ~List() noexcept;
 
-    List< T >& operator=(const List< T >& other);
-    List< T >& operator=(List< T >&& other) noexcept;
-    List< T >& operator=(std::initializer_list< T > il);
+    List< T, Alloc >& operator=(const List< T, Alloc >& other);
+    List< T, Alloc >& operator=(List< T, Alloc >&& other) noexcept;
+    List< T, Alloc >& operator=(std::initializer_list< T > il);
 
     Iterator< T > begin() noexcept;
     ConstIterator< T > begin() const noexcept;
@@ -66,12 +72,12 @@ namespace alymova
     Iterator< T > emplace_back(Args&&... args);
     template< typename... Args >
     Iterator< T > emplace(Iterator< T > position, Args&&... args);
-    void swap(List< T >& other) noexcept;
+    void swap(List< T, Alloc >& other) noexcept;
     void clear() noexcept;
 
-    void splice(Iterator< T > position, List< T >& other);
-    void splice(Iterator< T > position, List< T >& other, Iterator< T > i);
-    void splice(Iterator< T > position, List< T >& other, Iterator< T > first, Iterator< T > last);
+    void splice(Iterator< T > position, List< T, Alloc >& other);
+    void splice(Iterator< T > position, List< T, Alloc >& other, Iterator< T > i);
+    void splice(Iterator< T > position, List< T, Alloc >& other, Iterator< T > first, Iterator< T > last);
     void remove(const T& value) noexcept;
     template< typename Predicate >
     void remove_if(Predicate pred);
@@ -81,37 +87,47 @@ namespace alymova
     void sort();
     template< typename Comparator >
     void sort(Comparator cmp);
-    void merge(List< T >& other);
+    void merge(List< T, Alloc >& other);
     template< typename Comparator >
-    void merge(List< T >& other, Comparator cmp);
+    void merge(List< T, Alloc >& other, Comparator cmp);
     void reverse() noexcept;
   private:
+    using node_allocator = typename std::allocator_traits< Alloc >::template rebind_alloc< detail::ListNode< T > >;
+    using pool_type = NodePool< detail::ListNode< T >, node_allocator >;
+
     detail::ListNode< T >* fake_;
     detail::ListNode< T >* head_;
+    node_allocator alloc_;
+    std::shared_ptr< pool_type > pool_;
 
     void push_single(detail::ListNode< T >* node);
+    template< typename... Args >
+    detail::ListNode< T >* create_node(Args&&... args);
+    void destroy_node(detail::ListNode< T >* node) noexcept;
+    void adopt_nodes(pool_type& pool) noexcept;
+    void share_pool(List< T, Alloc >& other, detail::ListNode< T >* node) noexcept;
   };
 
-  template< typename T >
-  bool operator==(const List< T >& lhs, const List< T >& rhs) noexcept;
+  template< typename T, typename Alloc >
+  bool operator==(const List< T, Alloc >& lhs, const List< T, Alloc >& rhs) noexcept;
 
-  template< typename T >
-  bool operator!=(const List< T >& lhs, const List< T >& rhs) noexcept;
+  template< typename T, typename Alloc >
+  bool operator!=(const List< T, Alloc >& lhs, const List< T, Alloc >& rhs) noexcept;
 
-  template< typename T >
-  bool operator<(const List< T >& lhs, const List< T >& rhs) noexcept;
+  template< typename T, typename Alloc >
+  bool operator<(const List< T, Alloc >& lhs, const List< T, Alloc >& rhs) noexcept;
 
-  template< typename T >
-  bool operator<=(const List< T >& lhs, const List< T >& rhs) noexcept;
+  template< typename T, typename Alloc >
+  bool operator<=(const List< T, Alloc >& lhs, const List< T, Alloc >& rhs) noexcept;
 
-  template< typename T >
-  bool operator>(const List< T >& lhs, const List< T >& rhs) noexcept;
+  template< typename T, typename Alloc >
+  bool operator>(const List< T, Alloc >& lhs, const List< T, Alloc >& rhs) noexcept;
 
-  template< typename T >
-  bool operator>=(const List< T >& lhs, const List< T >& rhs) noexcept;
+  template< typename T, typename Alloc >
+  bool operator>=(const List< T, Alloc >& lhs, const List< T, Alloc >& rhs) noexcept;
 
-  template< typename T >
-  bool operator==(const List< T >& lhs, const List< T >& rhs) noexcept
+  template< typename T, typename Alloc >
+  bool operator==(const List< T, Alloc >& lhs, const List< T, Alloc >& rhs) noexcept
   {
     if (lhs.size() != rhs.size())
     {
@@ -127,14 +143,14 @@ namespace alymova
     return true;
   }
 
-  template< typename T >
-  bool operator!=(const List< T >& lhs, const List< T >& rhs) noexcept
+  template< typename T, typename Alloc >
+  bool operator!=(const List< T, Alloc >& lhs, const List< T, Alloc >& rhs) noexcept
   {
     return (!(lhs == rhs));
   }
 
-  template< typename T >
-  bool operator<(const List< T >& lhs, const List< T >& rhs) noexcept
+  template< typename T, typename Alloc >
+  bool operator<(const List< T, Alloc >& lhs, const List< T, Alloc >& rhs) noexcept
   {
     auto it_lhs = lhs.cbegin(), it_rhs = rhs.cbegin();
     for (; it_lhs != lhs.cend() && it_rhs != rhs.cend(); ++it_lhs, ++it_rhs)
@@ -147,43 +163,57 @@ namespace alymova
     return (it_lhs == lhs.cend() && it_rhs != rhs.cend());
   }
 
-  template< typename T >
-  bool operator<=(const List< T >& lhs, const List< T >& rhs) noexcept
+  template< typename T, typename Alloc >
+  bool operator<=(const List< T, Alloc >& lhs, const List< T, Alloc >& rhs) noexcept
   {
     return (!(rhs < lhs));
   }
 
-  template< typename T >
-  bool operator>(const List< T >& lhs, const List< T >& rhs) noexcept
+  template< typename T, typename Alloc >
+  bool operator>(const List< T, Alloc >& lhs, const List< T, Alloc >& rhs) noexcept
   {
     return (rhs < lhs);
   }
 
-  template< typename T >
-  bool operator>=(const List< T >& lhs, const List< T >& rhs) noexcept
+  template< typename T, typename Alloc >
+  bool operator>=(const List< T, Alloc >& lhs, const List< T, Alloc >& rhs) noexcept
   {
     return (!(lhs < rhs));
   }
 
-  template< typename T >
-  List< T >::List():
-    fake_(new detail::ListNode< T >{T(), nullptr, nullptr}),
-    head_(fake_)
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List():
+    List(Alloc())
   {}
 
-  template< typename T >
-  List< T >::List(const List< T >& other):
-    List(other.begin(), other.end())
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(const Alloc& alloc):
+    fake_(new detail::ListNode< T >{T(), nullptr, nullptr}),
+    head_(fake_),
+    alloc_(alloc),
+    pool_()
   {}
 
-  template< typename T >
-  List< T >::List(List< T >&& other) noexcept:
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(const List< T, Alloc >& other):
+    List(Alloc(other.alloc_))
+  {
+    for (auto it = other.begin(); it != other.end(); ++it)
+    {
+      push_back(*it);
+    }
+  }
+
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(List< T, Alloc >&& other) noexcept:
     fake_(std::exchange(other.fake_, nullptr)),
-    head_(std::exchange(other.head_, nullptr))
+    head_(std::exchange(other.head_, nullptr)),
+    alloc_(other.alloc_),
+    pool_(std::move(other.pool_))
   {}
 
-  template< typename T >
-  List< T >::List(size_t n, const T& value):
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(size_t n, const T& value):
     List()
   {
     for (size_t i = 0; i < n; i++)
@@ -192,9 +222,9 @@ namespace alymova
     }
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< typename InputIterator >
-  List< T >::List(InputIterator first, InputIterator last):
+  List< T, Alloc >::List(InputIterator first, InputIterator last):
     List()
   {
     for(; first != last; ++first)
@@ -203,117 +233,116 @@ namespace alymova
     }
   }
 
-  template< typename T >
-  List< T >::List(std::initializer_list< T > il):
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(std::initializer_list< T > il):
     List(il.begin(), il.end())
   {}
 
-  template< typename T >
-  List< T >& List< T >::operator=(const List< T >& other)
+  template< typename T, typename Alloc >
+  List< T, Alloc >& List< T, Alloc >::operator=(const List< T, Alloc >& other)
   {
     assert(this != std::addressof(other) && "Assigning a list to itself");
-    List< T > copy(other);
+    List< T, Alloc > copy(other);
     swap(copy);
     return *this;
   }
 
-  template< typename T >
-  List< T >& List< T >::operator=(List< T >&& other) noexcept
+  template< typename T, typename Alloc >
+  List< T, Alloc >& List< T, Alloc >::operator=(List< T, Alloc >&& other) noexcept
   {
     assert(this != std::addressof(other) && "Assigning a list to itself");
-    clear();
-    fake_ = std::exchange(other.fake_, nullptr);
-    head_ = std::exchange(other.head_, nullptr);
+    List< T, Alloc > moved(std::move(other));
+    swap(moved);
     return *this;
   }
 
-  template< typename T >
-  List< T >& List< T >::operator=(std::initializer_list< T > il)
+  template< typename T, typename Alloc >
+  List< T, Alloc >& List< T, Alloc >::operator=(std::initializer_list< T > il)
   {
-    List< T > copy(il);
+    List< T, Alloc > copy(il);
     swap(copy);
     return *this;
   }
 
-  template< typename T >
-  List< T >::~List() noexcept
+  template< typename T, typename Alloc >
+  List< T, Alloc >::~List() noexcept
   {
     clear();
     delete fake_;
   }
 
-  template< typename T >
-  Iterator< T > List< T >::begin() noexcept
+  template< typename T, typename Alloc >
+  Iterator< T > List< T, Alloc >::begin() noexcept
   {
     return Iterator< T >(head_);
   }
 
-  template< typename T >
-  ConstIterator< T > List< T >::begin() const noexcept
+  template< typename T, typename Alloc >
+  ConstIterator< T > List< T, Alloc >::begin() const noexcept
   {
     return ConstIterator< T >(head_);
   }
 
-  template< typename T >
-  ConstIterator< T > List< T >::cbegin() const noexcept
+  template< typename T, typename Alloc >
+  ConstIterator< T > List< T, Alloc >::cbegin() const noexcept
   {
     return begin();
   }
 
-  template< typename T >
-  Iterator< T > List< T >::end() noexcept
+  template< typename T, typename Alloc >
+  Iterator< T > List< T, Alloc >::end() noexcept
   {
     return Iterator< T >(fake_);
   }
 
-  template< typename T >
-  ConstIterator< T > List< T >::end() const noexcept
+  template< typename T, typename Alloc >
+  ConstIterator< T > List< T, Alloc >::end() const noexcept
   {
     return ConstIterator< T >(fake_);
   }
 
-  template< typename T >
-  ConstIterator< T > List< T >::cend() const noexcept
+  template< typename T, typename Alloc >
+  ConstIterator< T > List< T, Alloc >::cend() const noexcept
   {
     return end();
   }
 
-  template< typename T >
-  T& List< T >::front() noexcept
+  template< typename T, typename Alloc >
+  T& List< T, Alloc >::front() noexcept
   {
     assert(!empty());
     return head_->data;
   }
 
-  template< typename T >
-  T& List< T >::back() noexcept
+  template< typename T, typename Alloc >
+  T& List< T, Alloc >::back() noexcept
   {
     assert(!empty());
     return fake_->prev->data;
   }
 
-  template< typename T >
-  const T& List< T >::front() const noexcept
+  template< typename T, typename Alloc >
+  const T& List< T, Alloc >::front() const noexcept
   {
     assert(!empty());
     return head_->data;
   }
 
-  template< typename T >
-  const T& List< T >::back() const noexcept
+  template< typename T, typename Alloc >
+  const T& List< T, Alloc >::back() const noexcept
   {
     assert(!empty());
     return fake_->prev->data;
   }
 
-  template< typename T >
-  bool List< T >::empty() const noexcept
+  template< typename T, typename Alloc >
+  bool List< T, Alloc >::empty() const noexcept
   {
     return cbegin() == cend();
   }
 
-  template< typename T >
-  size_t List< T >::size() const noexcept
+  template< typename T, typename Alloc >
+  size_t List< T, Alloc >::size() const noexcept
   {
     size_t size = 0;
     for (auto it = begin(); it != end(); ++it)
@@ -323,8 +352,8 @@ namespace alymova
     return size;
   }
 
-  template< typename T >
-  void List< T >::assign(size_t n, const T& value)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::assign(size_t n, const T& value)
   {
     clear();
     for (size_t i = 0; i < n; ++i)
@@ -333,9 +362,9 @@ namespace alymova
     }
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< typename InputIterator >
-  void List< T >::assign(InputIterator first, InputIterator last)
+  void List< T, Alloc >::assign(InputIterator first, InputIterator last)
   {
     clear();
     for (; first != last; ++first)
@@ -344,48 +373,48 @@ namespace alymova
     }
   }
 
-  template< typename T >
-  void List< T >::assign(std::initializer_list< T > il)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::assign(std::initializer_list< T > il)
   {
     assign(il.begin(), il.end());
   }
 
-  template< typename T >
-  void List< T >::push_front(const T& value)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::push_front(const T& value)
   {
     emplace_front(value);
   }
 
-  template< typename T >
-  void List< T >::push_front(T&& value)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::push_front(T&& value)
   {
     emplace_front(std::forward< T >(value));
   }
 
-  template< typename T >
-  void List< T >::pop_front() noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::pop_front() noexcept
   {
     assert(!empty());
     detail::ListNode< T >* subhead = head_->next;
-    delete head_;
+    destroy_node(head_);
     head_ = subhead;
     head_->prev = nullptr;
   }
 
-  template< typename T >
-  void List< T >::push_back(const T& value)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::push_back(const T& value)
   {
     emplace_back(value);
   }
 
-  template< typename T >
-  void List< T >::push_back(T&& value)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::push_back(T&& value)
   {
     emplace_back(std::forward< T >(value));
   }
 
-  template< typename T >
-  void List< T >::pop_back() noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::pop_back() noexcept
   {
     assert(!empty());
     detail::ListNode< T >* subhead = fake_->prev;
@@ -393,30 +422,30 @@ namespace alymova
     {
       head_ = fake_;
       fake_->prev = nullptr;
-      delete subhead;
+      destroy_node(subhead);
     }
     else
     {
       subhead->prev->next = fake_;
       fake_->prev = subhead->prev;
-      delete subhead;
+      destroy_node(subhead);
     }
   }
 
-  template< typename T >
-  Iterator< T > List< T >::insert(Iterator< T > position, const T& value)
+  template< typename T, typename Alloc >
+  Iterator< T > List< T, Alloc >::insert(Iterator< T > position, const T& value)
   {
     return emplace(position, value);
   }
 
-  template< typename T >
-  Iterator< T > List< T >::insert(Iterator< T > position, T&& value)
+  template< typename T, typename Alloc >
+  Iterator< T > List< T, Alloc >::insert(Iterator< T > position, T&& value)
   {
     return emplace(position, std::forward< T >(value));
   }
 
-  template< typename T >
-  Iterator< T > List< T >::insert(Iterator< T > position, size_t n, const T& value)
+  template< typename T, typename Alloc >
+  Iterator< T > List< T, Alloc >::insert(Iterator< T > position, size_t n, const T& value)
   {
     Iterator< T > return_it = insert(position, value);
     for (size_t i = 1; i < n; i++)
@@ -427,9 +456,9 @@ namespace alymova
     return return_it;
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< typename InputIterator >
-  Iterator< T > List< T >::insert(Iterator< T > position, InputIterator first, InputIterator last)
+  Iterator< T > List< T, Alloc >::insert(Iterator< T > position, InputIterator first, InputIterator last)
   {
     Iterator< T > return_it = insert(position, *first);
     ++first;
@@ -441,14 +470,14 @@ namespace alymova
     return return_it;
   }
 
-  template< typename T >
-  Iterator< T > List< T >::insert(Iterator< T > position, std::initializer_list< T > il)
+  template< typename T, typename Alloc >
+  Iterator< T > List< T, Alloc >::insert(Iterator< T > position, std::initializer_list< T > il)
   {
     return insert(position, il.begin(), il.end());
   }
 
-  template< typename T >
-  Iterator< T > List< T >::erase(Iterator< T > position)
+  template< typename T, typename Alloc >
+  Iterator< T > List< T, Alloc >::erase(Iterator< T > position)
   {
     auto return_it = Iterator< T >(position.node_->next);
     if (position == begin())
@@ -464,13 +493,13 @@ namespace alymova
       detail::ListNode< T >* node = position.node_;
       node->prev->next = node->next;
       node->next->prev = node->prev;
-      delete node;
+      destroy_node(node);
     }
     return return_it;
   }
 
-  template< typename T >
-  Iterator< T > List< T >::erase(Iterator< T > first, Iterator< T > last)
+  template< typename T, typename Alloc >
+  Iterator< T > List< T, Alloc >::erase(Iterator< T > first, Iterator< T > last)
   {
     while (first != last)
     {
@@ -482,11 +511,11 @@ namespace alymova
     return last;
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< typename... Args >
-  Iterator< T > List< T >::emplace_front(Args&&... args)
+  Iterator< T > List< T, Alloc >::emplace_front(Args&&... args)
   {
-    auto node = new detail::ListNode< T >{T{std::forward< Args >(args)...}, nullptr, nullptr};
+    auto node = create_node(std::forward< Args >(args)...);
     if (empty())
     {
       push_single(node);
@@ -501,11 +530,11 @@ namespace alymova
     return begin();
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< typename... Args >
-  Iterator< T > List< T >::emplace_back(Args&&... args)
+  Iterator< T > List< T, Alloc >::emplace_back(Args&&... args)
   {
-    auto node = new detail::ListNode< T >{T{std::forward< Args >(args)...}, nullptr, nullptr};
+    auto node = create_node(std::forward< Args >(args)...);
     if (empty())
     {
       push_single(node);
@@ -521,9 +550,9 @@ namespace alymova
     return (--end());
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< typename... Args >
-  Iterator< T > List< T >::emplace(Iterator< T > position, Args&&... args)
+  Iterator< T > List< T, Alloc >::emplace(Iterator< T > position, Args&&... args)
   {
     if (position == begin())
     {
@@ -535,7 +564,7 @@ namespace alymova
     }
     else
     {
-      auto node_new = new detail::ListNode< T >{T{std::forward< Args >(args)...}, nullptr, nullptr};
+      auto node_new = create_node(std::forward< Args >(args)...);
       detail::ListNode< T >* node_now = position.node_;
       node_now->prev->next = node_new;
       node_new->prev = node_now->prev;
@@ -545,31 +574,40 @@ namespace alymova
     return --position;
   }
 
-  template< typename T >
-  void List< T >::swap(List< T >& other) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::swap(List< T, Alloc >& other) noexcept
   {
     std::swap(fake_, other.fake_);
     std::swap(head_, other.head_);
+    std::swap(alloc_, other.alloc_);
+    std::swap(pool_, other.pool_);
   }
 
-  template< typename T >
-  void List< T >::clear() noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::clear() noexcept
   {
+    if (std::is_trivially_destructible< T >::value && pool_.use_count() == 1 && !pool_->merged())
+    {
+      pool_->release();
+      head_ = fake_;
+      fake_->prev = nullptr;
+      return;
+    }
     while (!empty())
     {
       pop_front();
     }
   }
 
-  template< typename T >
-  void List< T >::splice(Iterator< T > position, List< T >& other)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::splice(Iterator< T > position, List< T, Alloc >& other)
   {
     assert(*this != other && "Splicing a list to itself");
     splice(position, other, other.begin(), other.end());
   }
 
-  template< typename T >
-  void List< T >::splice(Iterator< T > position, List< T >& other, Iterator< T > other_it)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::splice(Iterator< T > position, List< T, Alloc >& other, Iterator< T > other_it)
   {
     assert(position.node_ != nullptr && "Iterator is not valid");
     assert(other_it.node_ != nullptr && "Iterator is not valid");
@@ -577,6 +615,7 @@ namespace alymova
 
     detail::ListNode< T >* node_now = position.node_;
     detail::ListNode< T >* other_node_now = other_it.node_;
+    share_pool(other, other_node_now);
     if (position == begin())
     {
       head_ = other_node_now;
@@ -599,8 +638,8 @@ namespace alymova
     node_now->prev = other_node_now;
   }
 
-  template< typename T >
-  void List< T >::splice(Iterator< T > position, List< T >& other, Iterator< T > first, Iterator< T > last)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::splice(Iterator< T > position, List< T, Alloc >& other, Iterator< T > first, Iterator< T > last)
   {
     auto other_it = first;
     while (other_it != last)
@@ -611,8 +650,8 @@ namespace alymova
     }
   }
 
-  template< typename T >
-  void List < T >::remove(const T& value) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::remove(const T& value) noexcept
   {
     struct EqualNode
     {
@@ -628,9 +667,9 @@ namespace alymova
     remove_if(EqualNode{value});
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< typename Predicate >
-  void List< T >::remove_if(Predicate pred)
+  void List< T, Alloc >::remove_if(Predicate pred)
   {
     assert(!empty());
     auto it = begin();
@@ -645,15 +684,15 @@ namespace alymova
     }
   }
 
-  template< typename T >
-  void List< T >::unique()
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::unique()
   {
     unique(std::equal_to< T >());
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< typename Comparator >
-  void List< T >::unique(Comparator cmp)
+  void List< T, Alloc >::unique(Comparator cmp)
   {
     detail::ListNode< T >* subhead = head_;
     auto it = begin();
@@ -673,15 +712,15 @@ namespace alymova
     }
   }
 
-  template< typename T >
-  void List< T >::sort()
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::sort()
   {
     sort(std::less< T >());
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< typename Comparator >
-  void List< T >::sort(Comparator cmp)
+  void List< T, Alloc >::sort(Comparator cmp)
   {
     for (auto it1 = begin(); it1 != end(); ++it1)
     {
@@ -698,15 +737,15 @@ namespace alymova
     }
   }
 
-  template< typename T >
-  void List< T >::merge(List< T >& other)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::merge(List< T, Alloc >& other)
   {
     merge(other, std::less< T >());
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< typename Comparator >
-  void List< T >::merge(List< T >& other, Comparator cmp)
+  void List< T, Alloc >::merge(List< T, Alloc >& other, Comparator cmp)
   {
     if (this == std::addressof(other))
     {
@@ -730,8 +769,8 @@ namespace alymova
     }
   }
 
-  template< typename T >
-  void List< T >::reverse() noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::reverse() noexcept
   {
     if (size() < 2)
     {
@@ -754,12 +793,95 @@ namespace alymova
     head_ = tail;
   }
 
-  template< typename T >
-  void List< T >::push_single(detail::ListNode< T >* node)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::push_single(detail::ListNode< T >* node)
   {
     head_ = node;
     head_->next = fake_;
     fake_->prev = head_;
   }
+
+  template< typename T, typename Alloc >
+  template< typename... Args >
+  detail::ListNode< T >* List< T, Alloc >::create_node(Args&&... args)
+  {
+    detail::ListNode< T >* place = nullptr;
+    if (!pool_ && empty())
+    {
+      place = pool_type::allocate_single(alloc_);
+    }
+    else
+    {
+      if (!pool_)
+      {
+        pool_ = std::allocate_shared< pool_type >(alloc_, alloc_);
+        adopt_nodes(*pool_);
+      }
+      place = pool_->allocate();
+    }
+    try
+    {
+      return new (place) detail::ListNode< T >{T{std::forward< Args >(args)...}, nullptr, nullptr};
+    }
+    catch (...)
+    {
+      if (pool_)
+      {
+        pool_->deallocate(place);
+      }
+      else
+      {
+        pool_type::deallocate_single(alloc_, place);
+      }
+      throw;
+    }
+  }
+
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::destroy_node(detail::ListNode< T >* node) noexcept
+  {
+    node->~ListNode();
+    if (pool_)
+    {
+      pool_->deallocate(node);
+    }
+    else
+    {
+      pool_type::deallocate_single(alloc_, node);
+    }
+  }
+
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::adopt_nodes(pool_type& pool) noexcept
+  {
+    for (auto it = begin(); it != end(); ++it)
+    {
+      pool.adopt(it.node_);
+    }
+  }
+
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::share_pool(List< T, Alloc >& other, detail::ListNode< T >* node) noexcept
+  {
+    if (pool_ == other.pool_)
+    {
+      return;
+    }
+    if (!other.pool_)
+    {
+      if (pool_)
+      {
+        pool_->adopt(node);
+      }
+      return;
+    }
+    if (!pool_)
+    {
+      adopt_nodes(*other.pool_);
+      pool_ = other.pool_;
+      return;
+    }
+    pool_type::merge(pool_, other.pool_);
+  }
 }
 #endif
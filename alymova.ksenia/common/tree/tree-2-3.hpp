@@ -96,6 +96,8 @@ namespace alymova
 
     void swap(Tree& other) noexcept;
     void clear() noexcept;
+    void set_lazy_erase(double max_garbage);
+    void compact();
 
     size_t count(const Key& key) const;
     Iterator find(const Key& key);
@@ -109,6 +111,8 @@ namespace alymova
 
   private:
     size_t size_;
+    size_t dead_;
+    double max_garbage_;
     Node* fake_right_;
     Node* fake_left_;
     Node* root_;
@@ -121,6 +125,8 @@ namespace alymova
     Node* find_to_insert(ConstIterator hint) const noexcept;
     bool check_hint(ConstIterator hint, const Key& key) const;
     Iterator find_to_erase(Iterator pos) const noexcept;
+    ConstIterator find_slot(const Key& key) const;
+    Node* build(ConstIterator& src, size_t count, size_t capacity, Node* parent);
     bool have_triple_neighbor(const Node* node) const noexcept;
     void fix(Node* node);
     void distribute_erase(Node* node);
@@ -166,6 +172,8 @@ namespace alymova
   template< class Key, class Value, class Comparator >
   TwoThreeTree< Key, Value, Comparator >::TwoThreeTree():
     size_(0),
+    dead_(0),
+    max_garbage_(0.0),
     fake_right_(reinterpret_cast< Node* >(new char[sizeof(Node)])),
     fake_left_(reinterpret_cast< Node* >(new char[sizeof(Node)])),
     root_(fake_right_)
@@ -179,11 +187,15 @@ namespace alymova
   template< class Key, class Value, class Comparator >
   TwoThreeTree< Key, Value, Comparator >::TwoThreeTree(const Tree& other):
     Tree(other.begin(), other.end())
-  {}
+  {
+    max_garbage_ = other.max_garbage_;
+  }
 
   template< class Key, class Value, class Comparator >
   TwoThreeTree< Key, Value, Comparator >::TwoThreeTree(Tree&& other) noexcept:
     size_(std::exchange(other.size_, 0)),
+    dead_(std::exchange(other.dead_, 0)),
+    max_garbage_(other.max_garbage_),
     fake_right_(std::exchange(other.fake_right_, nullptr)),
     fake_left_(std::exchange(other.fake_left_, nullptr)),
     root_(std::exchange(other.root_, nullptr))
@@ -286,7 +298,12 @@ namespace alymova
     {
       tmp = tmp->left;
     }
-    return ConstIterator(tmp, NodePoint::First);
+    ConstIterator first(tmp, NodePoint::First);
+    if (first.is_dead())
+    {
+      ++first;
+    }
+    return first;
   }
 
   template< class Key, class Value, class Comparator >
@@ -496,14 +513,26 @@ namespace alymova
     {
       return it_value;
     }
+    if (dead_)
+    {
+      Iterator slot = find_slot(value.first);
+      if (slot != end())
+      {
+        *slot = std::move(value);
+        slot.node_->dead[slot.point_ - 1] = false;
+        dead_--;
+        size_++;
+        return slot;
+      }
+    }
     Node* to_insert = find_to_insert(hint);
-    if (!check_hint(hint, value.first))
+    if (dead_ || !check_hint(hint, value.first))
     {
       to_insert = find_to_insert(value.first);
     }
     if (size_ == 0)
     {
-      root_ = new Node{{}, NodeType::Empty, nullptr, nullptr, nullptr, nullptr, nullptr};
+      root_ = new Node{{}, NodeType::Empty, nullptr, nullptr, nullptr, nullptr, nullptr, {}};
       to_insert = root_;
     }
     try
@@ -541,6 +570,26 @@ namespace alymova
   TTTIterator< Key, Value, Comparator > TwoThreeTree< Key, Value, Comparator >::erase(Iterator pos)
   {
     assert(pos != end() && "Removing from empty map");
+    if (max_garbage_ > 0)
+    {
+      Iterator next = pos;
+      ++next;
+      pos.node_->dead[pos.point_ - 1] = true;
+      size_--;
+      dead_++;
+      if (size_ != 0 && dead_ <= max_garbage_ * (size_ + dead_))
+      {
+        return next;
+      }
+      if (next == end())
+      {
+        compact();
+        return end();
+      }
+      Key key_next = next->first;
+      compact();
+      return find(key_next);
+    }
     Key key_next;
     NodePoint point_next = NodePoint::Empty;
     Iterator pos_next = (++pos);
@@ -584,6 +633,8 @@ namespace alymova
   void TwoThreeTree< Key, Value, Comparator >::swap(Tree& other) noexcept
   {
     std::swap(size_, other.size_);
+    std::swap(dead_, other.dead_);
+    std::swap(max_garbage_, other.max_garbage_);
     std::swap(fake_right_, other.fake_right_);
     std::swap(fake_left_, other.fake_left_);
     std::swap(root_, other.root_);
@@ -595,6 +646,41 @@ namespace alymova
   {
     clear(root_);
     size_ = 0;
+    dead_ = 0;
+  }
+
+  template< class Key, class Value, class Comparator >
+  void TwoThreeTree< Key, Value, Comparator >::set_lazy_erase(double max_garbage)
+  {
+    max_garbage_ = max_garbage;
+    if (max_garbage_ <= 0)
+    {
+      compact();
+    }
+  }
+
+  template< class Key, class Value, class Comparator >
+  void TwoThreeTree< Key, Value, Comparator >::compact()
+  {
+    if (dead_ == 0)
+    {
+      return;
+    }
+    Node* root = fake_right_;
+    if (size_ != 0)
+    {
+      size_t capacity = 2;
+      while (capacity < size_)
+      {
+        capacity = capacity * 3 + 2;
+      }
+      ConstIterator src = cbegin();
+      root = build(src, size_, capacity, nullptr);
+    }
+    clear(root_);
+    root_ = root;
+    dead_ = 0;
+    move_fake();
   }
 
   template< class Key, class Value, class Comparator >
@@ -711,11 +797,12 @@ namespace alymova
       parent = node->parent;
       if (!parent)
       {
-        parent = new Node{{}, NodeType::Empty, nullptr, nullptr, nullptr, nullptr, nullptr};
+        parent = new Node{{}, NodeType::Empty, nullptr, nullptr, nullptr, nullptr, nullptr, {}};
         root_ = parent;
       }
-      left = new Node{{node->data[0]}, NodeType::Double, parent, node->left, nullptr, node->mid, nullptr};
-      right = new Node{{node->data[2]}, NodeType::Double, parent, node->right, nullptr, node->overflow, nullptr};
+      left = new Node{{node->data[0]}, NodeType::Double, parent, node->left, nullptr, node->mid, nullptr, {node->dead[0]}};
+      right = new Node{{node->data[2]}, NodeType::Double, parent, node->right, nullptr, node->overflow, nullptr,
+        {node->dead[2]}};
       if (left->left && left->left != fake_left_)
       {
         left->left->parent = left;
@@ -727,7 +814,7 @@ namespace alymova
       {
         right->left = nullptr;
       }
-      parent->insert(node->data[1]);
+      parent->insert(node->data[1], node->dead[1]);
       {
         if (parent->type == NodeType::Double)
         {
@@ -887,6 +974,75 @@ namespace alymova
     return {node_instead, point};
   }
 
+  template< class Key, class Value, class Comparator >
+  TTTConstIterator< Key, Value, Comparator > TwoThreeTree< Key, Value, Comparator >::find_slot(const Key& key) const
+  {
+    Node* tmp = root_;
+    while (tmp && tmp->type != NodeType::Fake)
+    {
+      if (cmp_(key, tmp->data[0].first))
+      {
+        tmp = tmp->left;
+      }
+      else if (!cmp_(tmp->data[0].first, key))
+      {
+        return ConstIterator(tmp, NodePoint::First);
+      }
+      else if (tmp->type == NodeType::Triple && cmp_(key, tmp->data[1].first))
+      {
+        tmp = tmp->mid;
+      }
+      else if (tmp->type == NodeType::Triple && !cmp_(tmp->data[1].first, key))
+      {
+        return ConstIterator(tmp, NodePoint::Second);
+      }
+      else
+      {
+        tmp = tmp->right;
+      }
+    }
+    return cend();
+  }
+
+  template< class Key, class Value, class Comparator >
+  detail::TTTNode< Key, Value, Comparator >* TwoThreeTree< Key, Value, Comparator >::build(ConstIterator& src,
+    size_t count, size_t capacity, Node* parent)
+  {
+    Node* node = new Node{{}, NodeType::Empty, parent, nullptr, nullptr, nullptr, nullptr, {}};
+    try
+    {
+      if (capacity == 2)
+      {
+        for (size_t i = 0; i < count; ++i, ++src)
+        {
+          node->data[i] = *src;
+        }
+        node->type = (count == 1) ? NodeType::Double : NodeType::Triple;
+        return node;
+      }
+      size_t child_capacity = (capacity - 2) / 3;
+      size_t kids = (count - 1 <= 2 * child_capacity) ? 2 : 3;
+      size_t rest = count - (kids - 1);
+      for (size_t i = 0; i < kids; ++i)
+      {
+        Node*& child = (i == 0) ? node->left : ((i + 1 == kids) ? node->right : node->mid);
+        child = build(src, rest / kids + (i < rest % kids), child_capacity, node);
+        if (i + 1 < kids)
+        {
+          node->data[i] = *src;
+          ++src;
+        }
+      }
+      node->type = (kids == 2) ? NodeType::Double : NodeType::Triple;
+    }
+    catch (...)
+    {
+      clear(node);
+      throw;
+    }
+    return node;
+  }
+
   template< class Key, class Value, class Comparator >
   bool TwoThreeTree< Key, Value, Comparator >::have_triple_neighbor(const Node* node) const noexcept
   {
@@ -30,6 +30,8 @@ namespace alymova
     Queue< std::pair< Node*, NodePoint > > nexts_;
 
     TTTConstBreadthIterator(Node* node, NodePoint point);
+    void step();
+    bool is_dead() const noexcept;
 
     friend class TwoThreeTree< Key, Value, Comparator >;
   };
@@ -72,6 +74,17 @@ namespace alymova
 
   template< class Key, class Value, class Comparator >
   TTTConstBreadthIterator< Key, Value, Comparator >& TTTConstBreadthIterator< Key, Value, Comparator >::operator++()
+  {
+    do
+    {
+      step();
+    }
+    while (is_dead());
+    return *this;
+  }
+
+  template< class Key, class Value, class Comparator >
+  void TTTConstBreadthIterator< Key, Value, Comparator >::step()
   {
     assert(node_.first != nullptr && "You are trying to access beyond tree's bounds");
     assert(node_.second != NodePoint::Fake && "You are trying to access beyond tree's bounds");
@@ -80,7 +93,7 @@ namespace alymova
     nexts_.pop();
     if (node_.second == NodePoint::Second)
     {
-      return (*this);
+      return;
     }
     Node* node = node_.first;
     if (node->left)
@@ -121,7 +134,12 @@ namespace alymova
         }
       }
     }
-    return (*this);
+  }
+
+  template< class Key, class Value, class Comparator >
+  bool TTTConstBreadthIterator< Key, Value, Comparator >::is_dead() const noexcept
+  {
+    return node_.first && node_.second != NodePoint::Fake && node_.first->dead[node_.second - 1];
   }
 
   template< class Key, class Value, class Comparator >
@@ -24,6 +24,17 @@ namespace alymova
 
   template< class Key, class Value, class Comparator >
   TTTConstIterator< Key, Value, Comparator>& TTTConstIterator< Key, Value, Comparator >::operator++() noexcept
+  {
+    do
+    {
+      next();
+    }
+    while (is_dead());
+    return *this;
+  }
+
+  template< class Key, class Value, class Comparator >
+  void TTTConstIterator< Key, Value, Comparator >::next() noexcept
   {
     assert(node_ != nullptr && "You are trying to access beyond tree's bounds");
     assert(node_->type != NodeType::Empty && "Incorrect node index");
@@ -35,7 +46,7 @@ namespace alymova
         node_ = node_->right;
         fall_left();
         point_ = (node_->type == NodeType::Fake) ? NodePoint::Fake : NodePoint::First;
-        return *this;
+        return;
       }
     }
     else if (node_->type == NodeType::Triple)
@@ -46,10 +57,10 @@ namespace alymova
         {
           node_ = node_->mid;
           fall_left();
-          return *this;
+          return;
         }
         point_ = NodePoint::Second;
-        return *this;
+        return;
       }
       else if (point_ == NodePoint::Second)
       {
@@ -58,7 +69,7 @@ namespace alymova
           node_ = node_->right;
           fall_left();
           point_ = (node_->type == NodeType::Fake) ? NodePoint::Fake : NodePoint::First;
-          return *this;
+          return;
         }
       }
     }
@@ -68,19 +79,18 @@ namespace alymova
       {
         node_ = node_->parent;
         point_ = NodePoint::First;
-        return *this;
+        return;
       }
       if (node_->parent->mid == node_)
       {
         node_ = node_->parent;
         point_ = NodePoint::Second;
-        return *this;
+        return;
       }
       node_ = node_->parent;
     }
     node_ = nullptr;
     point_ = NodePoint::Fake;
-    return *this;
   }
 
   template< class Key, class Value, class Comparator >
@@ -93,6 +103,17 @@ namespace alymova
 
   template< class Key, class Value, class Comparator >
   TTTConstIterator< Key, Value, Comparator>& TTTConstIterator< Key, Value, Comparator >::operator--() noexcept
+  {
+    do
+    {
+      prev();
+    }
+    while (is_dead());
+    return *this;
+  }
+
+  template< class Key, class Value, class Comparator >
+  void TTTConstIterator< Key, Value, Comparator >::prev() noexcept
   {
     assert(node_ != nullptr && "You are trying to access beyond tree's bounds");
 
@@ -103,7 +124,7 @@ namespace alymova
         node_ = node_->left;
         fall_right();
         point_ = (node_->type == NodeType::Double) ? NodePoint::First : NodePoint::Second;
-        return *this;
+        return;
       }
     }
     else if (node_->type == NodeType::Triple)
@@ -115,7 +136,7 @@ namespace alymova
           node_ = node_->left;
           fall_right();
           point_ = (node_->type == NodeType::Double) ? NodePoint::First : NodePoint::Second;
-          return *this;
+          return;
         }
       }
       else if (point_ == NodePoint::Second)
@@ -125,10 +146,10 @@ namespace alymova
           node_ = node_->mid;
           fall_right();
           point_ = (node_->type == NodeType::Double) ? NodePoint::First : NodePoint::Second;
-          return *this;
+          return;
         }
         point_ = NodePoint::First;
-        return *this;
+        return;
       }
     }
     while (node_->parent)
@@ -137,19 +158,18 @@ namespace alymova
       {
         node_ = node_->parent;
         point_ = (node_->type == NodeType::Double) ? NodePoint::First : NodePoint::Second;
-        return *this;
+        return;
       }
       if (node_->parent->mid == node_)
       {
         node_ = node_->parent;
         point_ = NodePoint::First;
-        return *this;
+        return;
       }
       node_ = node_->parent;
     }
     node_ = nullptr;
     point_ = NodePoint::Fake;
-    return *this;
   }
 
   template< class Key, class Value, class Comparator >
@@ -192,6 +212,12 @@ namespace alymova
     return std::addressof(node_->data[point_ - 1]);
   }
 
+  template< class Key, class Value, class Comparator >
+  bool TTTConstIterator< Key, Value, Comparator >::is_dead() const noexcept
+  {
+    return node_ && point_ != NodePoint::Fake && node_->dead[point_ - 1];
+  }
+
   template< class Key, class Value, class Comparator >
   void TTTConstIterator< Key, Value, Comparator >::fall_left()
   {
@@ -43,6 +43,9 @@ namespace alymova
     TTTConstIterator(Node* node, NodePoint point);
     TTTConstIterator(TTTIterator< Key, Value, Comparator > it);
 
+    void next() noexcept;
+    void prev() noexcept;
+    bool is_dead() const noexcept;
     void fall_left();
     void fall_right();
 
@@ -76,6 +79,9 @@ namespace alymova
     TTTIterator(TTTConstIterator< Key, Value, Comparator > it);
     TTTIterator(Node* node, NodePoint point);
 
+    void next() noexcept;
+    void prev() noexcept;
+    bool is_dead() const noexcept;
     void fall_left();
     void fall_right();
 
@@ -1,5 +1,6 @@
 #ifndef TREE_NODE_HPP
 #define TREE_NODE_HPP
+#include <cstddef>
 #include <utility>
 #include "tree-iterators.hpp"
 
@@ -21,18 +22,21 @@ namespace alymova
       Node* mid;
       Node* right;
       Node* overflow;
+      bool dead[3];
 
-      void insert(const std::pair< Key, Value >& value);
+      void insert(const std::pair< Key, Value >& value, bool is_dead = false);
       void remove(NodePoint point) noexcept;
+      void swap_data(size_t i, size_t j);
       bool isLeaf() const noexcept;
       void clear()noexcept;
     };
 
     template< class Key, class Value, class Comparator >
-    void TTTNode< Key, Value, Comparator >::insert(const std::pair< Key, Value >& value)
+    void TTTNode< Key, Value, Comparator >::insert(const std::pair< Key, Value >& value, bool is_dead)
     {
       Comparator cmp;
       data[type] = value;
+      dead[type] = is_dead;
       if (type == NodeType::Empty)
       {
         type = NodeType::Double;
@@ -42,18 +46,18 @@ namespace alymova
       {
         if (cmp(data[1].first, data[0].first))
         {
-          std::swap(data[0], data[1]);
+          swap_data(0, 1);
         }
         type = NodeType::Triple;
         return;
       }
       if (cmp(data[2].first, data[1].first))
       {
-        std::swap(data[2], data[1]);
+        swap_data(2, 1);
       }
       if (cmp(data[1].first, data[0].first))
       {
-        std::swap(data[1], data[0]);
+        swap_data(1, 0);
       }
       type = NodeType::Overflow;
     }
@@ -69,12 +73,19 @@ namespace alymova
       }
       if (point == NodePoint::First)
       {
-        std::swap(data[0], data[1]);
+        swap_data(0, 1);
       }
       type = NodeType::Double;
       return;
     }
 
+    template< class Key, class Value, class Comparator >
+    void TTTNode< Key, Value, Comparator >::swap_data(size_t i, size_t j)
+    {
+      std::swap(data[i], data[j]);
+      std::swap(dead[i], dead[j]);
+    }
+
     template< class Key, class Value, class Comparator >
     bool TTTNode< Key, Value, Comparator >::isLeaf() const noexcept
     {
@@ -32,6 +32,8 @@ namespace alymova
     Stack< std::pair< Node*, NodePoint > > nexts_;
 
     TTTConstRnlIterator(Node* root, NodePoint point);
+    void step();
+    bool is_dead() const noexcept;
 
     friend class TwoThreeTree< Key, Value, Comparator >;
   };
@@ -91,6 +93,17 @@ namespace alymova
 
   template< class Key, class Value, class Comparator >
   TTTConstRnlIterator< Key, Value, Comparator >& TTTConstRnlIterator< Key, Value, Comparator >::operator++()
+  {
+    do
+    {
+      step();
+    }
+    while (is_dead());
+    return *this;
+  }
+
+  template< class Key, class Value, class Comparator >
+  void TTTConstRnlIterator< Key, Value, Comparator >::step()
   {
     assert(node_.first != nullptr && "You are trying to access beyond tree's bounds");
     assert(node_.second != NodePoint::Fake && "You are trying to access beyond tree's bounds");
@@ -114,7 +127,7 @@ namespace alymova
     {
       nexts_.push({node_.first, NodePoint::First});
       tmp_.first = node_.first->mid;
-      return *this;
+      return;
     }
     tmp_.first = node_.first->left;
     if (tmp_.first)
@@ -124,7 +137,12 @@ namespace alymova
         tmp_.second = NodePoint::Fake;
       }
     }
-    return *this;
+  }
+
+  template< class Key, class Value, class Comparator >
+  bool TTTConstRnlIterator< Key, Value, Comparator >::is_dead() const noexcept
+  {
+    return node_.first && node_.second != NodePoint::Fake && node_.first->dead[node_.second - 1];
   }
 
   template< class Key, class Value, class Comparator >
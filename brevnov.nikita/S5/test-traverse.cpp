@@ -1,4 +1,5 @@
 #include <sstream>
+#include <type_traits>
 #include <string>
 #include <boost/test/tools/interface.hpp>
 #include <boost/test/unit_test.hpp>
@@ -27,3 +28,31 @@ BOOST_AUTO_TEST_CASE(traverse)
   iss << funBr.sum << funBr.str;
   BOOST_TEST(iss.str() == "60 a b c d e");
 }
+
+BOOST_AUTO_TEST_CASE(traverse_iterators)
+{
+  using Tree = AVLTree< int, std::string >;
+  static_assert(std::is_trivially_copyable< Tree::ConstLnrIter >::value, "LnrIterator must be trivially copyable");
+  static_assert(std::is_trivially_copyable< Tree::ConstRnlIter >::value, "RnlIterator must be trivially copyable");
+  Tree tree;
+  for (int i = 0; i < 1000; ++i)
+  {
+    tree.insert({ (i * 7) % 1000, "v" });
+  }
+  int expected = 0;
+  for (Tree::ConstLnrIter it = tree.lnrCbegin(); it != tree.lnrCend(); ++it)
+  {
+    BOOST_TEST(it->first == expected++);
+  }
+  BOOST_TEST(expected == 1000);
+  for (Tree::ConstRnlIter it = tree.rnlCbegin(); it != tree.rnlCend(); it++)
+  {
+    BOOST_TEST(it->first == --expected);
+  }
+  BOOST_TEST(expected == 0);
+  Tree::LnrIter it = tree.lnrBegin();
+  Tree::ConstLnrIter cit = it;
+  Tree::ConstLnrIter next = tree.lnrCbegin();
+  ++next;
+  BOOST_CHECK(++cit == next);
+}
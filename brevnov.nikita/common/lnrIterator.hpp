@@ -4,7 +4,6 @@
 #include <iterator>
 #include <utility>
 #include "iterator.hpp"
-#include "stack.hpp"
 #include "treeNode.hpp"
 namespace brevnov
 {
@@ -23,12 +22,12 @@ namespace brevnov
 
     LnrIterator() noexcept;
     template < bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > = 0 >
-    LnrIterator(const LnrIterator< Key, Value, Cmp, OtherIsConst >&);
+    LnrIterator(const LnrIterator< Key, Value, Cmp, OtherIsConst >&) noexcept;
     template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > = 0 >
-    LnrIterator< Key, Value, Cmp, IsConst > operator=(const LnrIterator< Key, Value, Cmp, OtherIsConst >&);
+    LnrIterator< Key, Value, Cmp, IsConst >& operator=(const LnrIterator< Key, Value, Cmp, OtherIsConst >&) noexcept;
 
-    LnrIterator< Key, Value, Cmp, IsConst > operator++();
-    LnrIterator< Key, Value, Cmp, IsConst > operator++(int);
+    LnrIterator< Key, Value, Cmp, IsConst >& operator++() noexcept;
+    LnrIterator< Key, Value, Cmp, IsConst > operator++(int) noexcept;
     bool operator==(const LnrIterator< Key, Value, Cmp, IsConst >&) const noexcept;
     bool operator!=(const LnrIterator< Key, Value, Cmp, IsConst >&) const noexcept;
 
@@ -36,7 +35,6 @@ namespace brevnov
     point operator->() const noexcept;
   private:
     Node* node_;
-    Stack< Node* > stack_;
     explicit LnrIterator(Node*) noexcept;
     friend class LnrIterator< Key, Value, Cmp, !IsConst >;
     friend class AVLTree< Key, Value, Cmp >;
@@ -44,34 +42,31 @@ namespace brevnov
 
   template< typename Key, typename Value, typename Cmp, bool IsConst >
   LnrIterator< Key, Value, Cmp, IsConst >::LnrIterator() noexcept:
-    node_(nullptr),
-    stack_()
+    node_(nullptr)
   {}
 
   template< typename Key, typename Value, typename Cmp, bool IsConst >
   template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > >
-  LnrIterator< Key, Value, Cmp, IsConst >::LnrIterator(const LnrIterator< Key, Value, Cmp, OtherIsConst >& copy):
-    node_(copy.node_),
-    stack_(copy.stack_)
+  LnrIterator< Key, Value, Cmp, IsConst >::LnrIterator(const LnrIterator< Key, Value, Cmp, OtherIsConst >& copy) noexcept:
+    node_(copy.node_)
   {}
 
   template< typename Key, typename Value, typename Cmp, bool IsConst >
   template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > >
-  LnrIterator< Key, Value, Cmp, IsConst > LnrIterator< Key, Value, Cmp, IsConst >::operator=(
-    const LnrIterator< Key, Value, Cmp, OtherIsConst >& copy)
+  LnrIterator< Key, Value, Cmp, IsConst >& LnrIterator< Key, Value, Cmp, IsConst >::operator=(
+    const LnrIterator< Key, Value, Cmp, OtherIsConst >& copy) noexcept
   {
-    stack_ = copy.stack_;
     node_ = copy.node_;
+    return *this;
   }
 
   template< typename Key, typename Value, typename Cmp, bool IsConst >
   LnrIterator< Key, Value, Cmp, IsConst >::LnrIterator(Node* node) noexcept:
-    node_(node),
-    stack_()
+    node_(node)
   {}
 
   template< typename Key, typename Value, typename Cmp, bool IsConst >
-  LnrIterator< Key, Value, Cmp, IsConst > LnrIterator< Key, Value, Cmp, IsConst >::operator++()
+  LnrIterator< Key, Value, Cmp, IsConst >& LnrIterator< Key, Value, Cmp, IsConst >::operator++() noexcept
   {
     if (!node_)
     {
@@ -79,36 +74,25 @@ namespace brevnov
     }
     if (node_->right)
     {
-      stack_.push(node_);
       node_ = node_->right;
       while (node_->left)
       {
-        stack_.push(node_);
         node_ = node_->left;
       }
     }
     else
     {
-      if (!stack_.empty() && stack_.top()->right == node_)
-      {
-        node_ = stack_.top();
-        stack_.pop();
-      }
-      if (stack_.empty())
-      {
-        node_ = nullptr;
-      }
-      else
+      while (node_->parent && node_ == node_->parent->right)
       {
-        node_ = stack_.top();
-        stack_.pop();
+        node_ = node_->parent;
       }
+      node_ = node_->parent;
     }
     return *this;
   }
 
   template< typename Key, typename Value, typename Cmp, bool IsConst >
-  LnrIterator< Key, Value, Cmp, IsConst > LnrIterator< Key, Value, Cmp, IsConst >::operator++(int)
+  LnrIterator< Key, Value, Cmp, IsConst > LnrIterator< Key, Value, Cmp, IsConst >::operator++(int) noexcept
   {
     LnrIterator< Key, Value, Cmp, IsConst > result(*this);
     ++(*this);
@@ -4,7 +4,6 @@
 #include <iterator>
 #include <utility>
 #include "iterator.hpp"
-#include "stack.hpp"
 #include "treeNode.hpp"
 namespace brevnov
 {
@@ -25,8 +24,8 @@ namespace brevnov
     template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > = 0 >
     RnlIterator< Key, Value, Cmp, IsConst >& operator=(const RnlIterator< Key, Value, Cmp, OtherIsConst >&) noexcept;
 
-    RnlIterator< Key, Value, Cmp, IsConst > operator++();
-    RnlIterator< Key, Value, Cmp, IsConst > operator++(int);
+    RnlIterator< Key, Value, Cmp, IsConst >& operator++() noexcept;
+    RnlIterator< Key, Value, Cmp, IsConst > operator++(int) noexcept;
 
     ref operator*() const noexcept;
     point operator->() const noexcept;
@@ -36,7 +35,6 @@ namespace brevnov
 
   private:
     Node* node_;
-    Stack< Node* > stack_;
     explicit RnlIterator(Node*) noexcept;
     friend class RnlIterator< Key, Value, Cmp, !IsConst >;
     friend class AVLTree< Key, Value, Cmp >;
@@ -44,15 +42,13 @@ namespace brevnov
 
   template< typename Key, typename Value, typename Cmp, bool IsConst >
   RnlIterator< Key, Value, Cmp, IsConst >::RnlIterator() noexcept:
-    node_(nullptr),
-    stack_()
+    node_(nullptr)
   {}
 
   template< typename Key, typename Value, typename Cmp, bool IsConst >
   template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > >
   RnlIterator< Key, Value, Cmp, IsConst >::RnlIterator(const RnlIterator< Key, Value, Cmp, OtherIsConst >& copy) noexcept:
-    node_(copy.node_),
-    stack_(copy.stack_)
+    node_(copy.node_)
   {}
 
   template< typename Key, typename Value, typename Cmp, bool IsConst >
@@ -61,56 +57,42 @@ namespace brevnov
     const RnlIterator< Key, Value, Cmp, OtherIsConst >& copy) noexcept
   {
     node_ = copy.node_;
-    stack_ = copy.stack_;
     return *this;
   }
 
   template< typename Key, typename Value, typename Cmp, bool IsConst >
   RnlIterator< Key, Value, Cmp, IsConst >::RnlIterator(Node* node) noexcept:
-    node_(node),
-    stack_()
+    node_(node)
   {}
 
   template< typename Key, typename Value, typename Cmp, bool IsConst >
-  RnlIterator< Key, Value, Cmp, IsConst > RnlIterator< Key, Value, Cmp, IsConst >::operator++()
+  RnlIterator< Key, Value, Cmp, IsConst >& RnlIterator< Key, Value, Cmp, IsConst >::operator++() noexcept
   {
     if (!node_)
     {
       return *this;
     }
-
     if (node_->left)
     {
-      stack_.push(node_);
       node_ = node_->left;
       while (node_->right)
       {
-        stack_.push(node_);
         node_ = node_->right;
       }
     }
     else
     {
-      while (!stack_.empty() && stack_.top()->left == node_)
-      {
-        node_ = stack_.top();
-        stack_.pop();
-      }
-      if (stack_.empty())
-      {
-        node_ = nullptr;
-      }
-      else
+      while (node_->parent && node_ == node_->parent->left)
       {
-        node_ = stack_.top();
-        stack_.pop();
+        node_ = node_->parent;
       }
+      node_ = node_->parent;
     }
     return *this;
   }
 
   template< typename Key, typename Value, typename Cmp, bool IsConst >
-  RnlIterator< Key, Value, Cmp, IsConst > RnlIterator< Key, Value, Cmp, IsConst >::operator++(int)
+  RnlIterator< Key, Value, Cmp, IsConst > RnlIterator< Key, Value, Cmp, IsConst >::operator++(int) noexcept
   {
     RnlIterator< Key, Value, Cmp, IsConst > result(*this);
     ++(*this);
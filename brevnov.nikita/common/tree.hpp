@@ -366,13 +366,12 @@ namespace brevnov
     {
       return lnrEnd();
     }
-    LnrIter it(root_);
-    while (it.node->left)
+    Node* temp = root_;
+    while (temp->left)
     {
-      it.stack_.push(it.node_);
-      it.node_ = it.node_->left;
+      temp = temp->left;
     }
-    return it;
+    return LnrIter(temp);
   }
 
   template< typename Key, typename Value, typename Cmp >
@@ -382,13 +381,12 @@ namespace brevnov
     {
       return lnrCend();
     }
-    LnrIter it(root_);
-    while (it.node_->left)
+    Node* temp = root_;
+    while (temp->left)
     {
-      it.stack_.push(it.node_);
-      it.node_ = it.node_->left;
+      temp = temp->left;
     }
-    return it;
+    return ConstLnrIter(temp);
   }
 
   template< typename Key, typename Value, typename Cmp >
@@ -410,13 +408,12 @@ namespace brevnov
     {
       return rnlEnd();
     }
-    RnlIter it(root_);
-    while (it.node_->right)
+    Node* temp = root_;
+    while (temp->right)
     {
-      it.stack_.push(it.node_);
-      it.node_ = it.node_->right;
+      temp = temp->right;
     }
-    return it;
+    return RnlIter(temp);
   }
 
   template< typename Key, typename Value, typename Cmp >
@@ -426,13 +423,12 @@ namespace brevnov
     {
       return rnlCend();
     }
-    ConstRnlIter it(root_);
-    while(it.node_->right)
+    Node* temp = root_;
+    while (temp->right)
     {
-      it.stack_.push(it.node_);
-      it.node_ = it.node_->right;
+      temp = temp->right;
     }
-    return it;
+    return ConstRnlIter(temp);
   }
 
   template< typename Key, typename Value, typename Cmp >
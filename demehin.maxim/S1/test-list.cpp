@@ -1,4 +1,6 @@
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <memory>
 #include <sstream>
 #include <list/list.hpp>
 
@@ -13,6 +15,46 @@ namespace
     }
     return out;
   }
+
+  template< typename T >
+  struct CountingAllocator
+  {
+    using value_type = T;
+    size_t* live;
+
+    explicit CountingAllocator(size_t& counter) noexcept:
+      live(std::addressof(counter))
+    {}
+
+    template< typename U >
+    CountingAllocator(const CountingAllocator< U >& other) noexcept:
+      live(other.live)
+    {}
+
+    T* allocate(size_t n)
+    {
+      ++*live;
+      return std::allocator< T >().allocate(n);
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept
+    {
+      --*live;
+      std::allocator< T >().deallocate(ptr, n);
+    }
+
+    template< typename U >
+    bool operator==(const CountingAllocator< U >& rhs) const noexcept
+    {
+      return live == rhs.live;
+    }
+
+    template< typename U >
+    bool operator!=(const CountingAllocator< U >& rhs) const noexcept
+    {
+      return live != rhs.live;
+    }
+  };
 }
 
 BOOST_AUTO_TEST_CASE(list_construct_test)
@@ -209,3 +251,64 @@ BOOST_AUTO_TEST_CASE(list_test)
   mlist.clear();
   BOOST_TEST(mlist.empty());
 }
+
+BOOST_AUTO_TEST_CASE(list_pool_test)
+{
+  using CountedList = demehin::List< int, CountingAllocator< int > >;
+  size_t allocations = 0;
+  CountingAllocator< int > alloc(allocations);
+  {
+    CountedList lst1(alloc);
+    lst1.push_back(1);
+    BOOST_TEST(allocations == 1);
+    lst1.push_back(2);
+    BOOST_TEST(allocations == 3);
+    lst1.push_back(3);
+    BOOST_TEST(allocations == 3);
+
+    CountedList lst2(alloc);
+    lst2.push_back(4);
+    lst1.splice(lst1.cend(), lst2);
+    BOOST_TEST(lst2.empty());
+    BOOST_TEST(allocations == 4);
+
+    CountedList lst3(alloc);
+    lst3.push_back(5);
+    lst3.splice(lst3.cbegin(), lst1, lst1.cbegin(), ++(++lst1.cbegin()));
+    BOOST_TEST(allocations == 5);
+    BOOST_TEST(lst1.size() == 2);
+    BOOST_TEST(lst3.size() == 3);
+
+    CountedList lst4(alloc);
+    lst4.push_back(6);
+    CountedList lst5(alloc);
+    lst5.push_back(7);
+    lst4.splice(lst4.cend(), lst5);
+    BOOST_TEST(allocations == 7);
+    lst4.push_back(8);
+    BOOST_TEST(allocations == 9);
+    lst3.splice(lst3.cend(), lst4);
+
+    int expected[] = { 1, 2, 5, 6, 7, 8 };
+    BOOST_TEST(lst3.size() == 6);
+    BOOST_TEST(std::equal(lst3.begin(), lst3.end(), expected));
+    lst1.clear();
+    lst3.clear();
+    BOOST_TEST(lst1.empty());
+    BOOST_TEST(lst3.empty());
+  }
+  BOOST_TEST(allocations == 0);
+
+  {
+    CountedList lst(alloc);
+    for (int i = 0; i < 100; ++i)
+    {
+      lst.push_back(i);
+    }
+    lst.clear();
+    BOOST_TEST(allocations == 1);
+    lst.push_back(1);
+    BOOST_TEST(lst.front() == 1);
+  }
+  BOOST_TEST(allocations == 0);
+}
@@ -1,21 +1,26 @@
 #ifndef LIST_HPP
 #define LIST_HPP
+#include <memory>
+#include <type_traits>
 #include <utility>
 #include "list_iterator.hpp"
 #include "list_node.hpp"
+#include "node_pool.hpp"
 
 namespace demehin
 {
-  template< typename T >
+  template< typename T, typename Alloc = std::allocator< T > >
   struct List
   {
   public:
     using Iter = ListIterator< T, false >;
     using cIter = ListIterator< T, true >;
+    using allocator_type = Alloc;
 
     List();
-    List(const List< T >&);
-    List(List< T >&&);
+    explicit List(const Alloc&);
+    List(const List< T, Alloc >&);
+    List(List< T, Alloc >&&);
 
     List(size_t, const T&);
     explicit List(std::initializer_list< T >);
@@ -24,14 +29,14 @@ namespace demehin
 
     ~List();
 
-    List< T >& operator=(const List< T >&);
-    List< T >& operator=(List< T >&&) noexcept;
-    bool operator==(const List< T >&) const noexcept;
-    bool operator!=(const List< T >&) const noexcept;
-    bool operator<(const List< T >&) const noexcept;
-    bool operator<=(const List< T >&) const noexcept;
-    bool operator>(const List< T >&) const noexcept;
-    bool operator>=(const List< T >&) const noexcept;
+    List< T, Alloc >& operator=(const List< T, Alloc >&);
+    List< T, Alloc >& operator=(List< T, Alloc >&&) noexcept;
+    bool operator==(const List< T, Alloc >&) const noexcept;
+    bool operator!=(const List< T, Alloc >&) const noexcept;
+    bool operator<(const List< T, Alloc >&) const noexcept;
+    bool operator<=(const List< T, Alloc >&) const noexcept;
+    bool operator>(const List< T, Alloc >&) const noexcept;
+    bool operator>=(const List< T, Alloc >&) const noexcept;
 
     Iter begin() const noexcept;
     Iter end() const noexcept;
@@ -58,12 +63,12 @@ namespace demehin
 
     void swap(List&) noexcept;
 
-    void splice(cIter pos, List< T >&) noexcept;
-    void splice(cIter pos, List< T >&&) noexcept;
-    void splice(cIter pos, List< T >&, cIter it) noexcept;
-    void splice(cIter pos, List< T >&&, cIter it) noexcept;
-    void splice(cIter pos, List< T >&, cIter first, cIter last) noexcept;
-    void splice(cIter pos, List< T >&&, cIter first, cIter last) noexcept;
+    void splice(cIter pos, List< T, Alloc >&) noexcept;
+    void splice(cIter pos, List< T, Alloc >&&) noexcept;
+    void splice(cIter pos, List< T, Alloc >&, cIter it) noexcept;
+    void splice(cIter pos, List< T, Alloc >&&, cIter it) noexcept;
+    void splice(cIter pos, List< T, Alloc >&, cIter first, cIter last) noexcept;
+    void splice(cIter pos, List< T, Alloc >&&, cIter first, cIter last) noexcept;
 
     void fill(Iter first, Iter last, const T&) noexcept;
 
@@ -90,76 +95,93 @@ namespace demehin
 
   private:
     using Node = demehin::Node< T >;
+    using node_allocator = typename std::allocator_traits< Alloc >::template rebind_alloc< Node >;
+    using pool_type = NodePool< Node, node_allocator >;
+
+    static constexpr size_t loose_limit = 1;
 
     Node* fake_;
     Node* tail_;
     size_t size_;
-
+    node_allocator alloc_;
+    std::shared_ptr< pool_type > pool_;
+
+    Node* createNode(const T&, Node*, Node*);
+    void destroyNode(Node*) noexcept;
+    void createPool();
+    void adoptNodes(pool_type&) noexcept;
+    void sharePool(List< T, Alloc >&, Node*, Node*) noexcept;
   };
 
   template< typename T >
   using Node = demehin::Node< T >;
 
-  template< typename T >
-  List< T >::List():
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List():
+    List(Alloc())
+  {}
+
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(const Alloc& alloc):
     fake_(reinterpret_cast< Node* >(new char[sizeof(Node)])),
     tail_(fake_),
-    size_(0)
+    size_(0),
+    alloc_(alloc),
+    pool_()
   {
     fake_->next = fake_;
     fake_->prev = fake_;
   }
 
-  template< typename T >
-  List< T >::List(size_t count, const T& value):
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(size_t count, const T& value):
     List()
   {
     assign(count, value);
   }
 
-  template< typename T >
-  List< T >::List(std::initializer_list< T > ilist):
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(std::initializer_list< T > ilist):
     List()
   {
     assign(ilist);
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< typename InputIt >
-  List< T >::List(InputIt first, InputIt last):
+  List< T, Alloc >::List(InputIt first, InputIt last):
     List()
   {
     assign(first, last);
   }
 
-  template< typename T >
-  List< T >::~List()
+  template< typename T, typename Alloc >
+  List< T, Alloc >::~List()
   {
     clear();
     delete[] reinterpret_cast< char* >(fake_);
   }
 
-  template< typename T >
-  List< T >& List< T >::operator=(const List< T >& other)
+  template< typename T, typename Alloc >
+  List< T, Alloc >& List< T, Alloc >::operator=(const List< T, Alloc >& other)
   {
     assign(other.begin(), other.end());
     return *this;
   }
 
-  template< typename T >
-  List< T >& List< T >::operator=(List< T >&& other) noexcept
+  template< typename T, typename Alloc >
+  List< T, Alloc >& List< T, Alloc >::operator=(List< T, Alloc >&& other) noexcept
   {
     if (this != std::addressof(other))
     {
-      tail_ = std::exchange(other.tail_, nullptr);
-      fake_ = std::exchange(other.fake_, nullptr);
-      size_ = std::exchange(other.size_, 0);
+      List< T, Alloc > temp(std::move(other));
+      swap(temp);
     }
     return *this;
   }
 
-  template< typename T >
-  bool List< T >::operator==(const List< T >& rhs) const noexcept
+  template< typename T, typename Alloc >
+  bool List< T, Alloc >::operator==(const List< T, Alloc >& rhs) const noexcept
   {
     if (size() != rhs.size())
     {
@@ -180,14 +202,14 @@ namespace demehin
     return true;
   }
 
-  template< typename T >
-  bool List< T >::operator!=(const List< T >& rhs) const noexcept
+  template< typename T, typename Alloc >
+  bool List< T, Alloc >::operator!=(const List< T, Alloc >& rhs) const noexcept
   {
     return !(*this == rhs);
   }
 
-  template< typename T >
-  bool List< T >::operator>(const List< T >& rhs) const noexcept
+  template< typename T, typename Alloc >
+  bool List< T, Alloc >::operator>(const List< T, Alloc >& rhs) const noexcept
   {
     auto it1 = begin();
     auto it2 = rhs.begin();
@@ -208,36 +230,45 @@ namespace demehin
     return size() > rhs.size();
   }
 
-  template< typename T >
-  bool List< T >::operator<=(const List< T >& rhs) const noexcept
+  template< typename T, typename Alloc >
+  bool List< T, Alloc >::operator<=(const List< T, Alloc >& rhs) const noexcept
   {
     return !(*this > rhs);
   }
 
-  template< typename T >
-  bool List< T >::operator<(const List< T >& rhs) const noexcept
+  template< typename T, typename Alloc >
+  bool List< T, Alloc >::operator<(const List< T, Alloc >& rhs) const noexcept
   {
     return rhs > *this;
   }
 
-  template< typename T >
-  bool List< T >::operator>=(const List< T >& rhs) const noexcept
+  template< typename T, typename Alloc >
+  bool List< T, Alloc >::operator>=(const List< T, Alloc >& rhs) const noexcept
   {
     return !(*this < rhs);
   }
 
-  template< typename T >
-  void List< T >::clear() noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::clear() noexcept
   {
+    if (std::is_trivially_destructible< T >::value && pool_.use_count() == 1 && !pool_->merged())
+    {
+      pool_->release();
+      fake_->next = fake_;
+      fake_->prev = fake_;
+      tail_ = fake_;
+      size_ = 0;
+      return;
+    }
     while (!empty())
     {
       pop_back();
     }
   }
 
-  template< typename T >
-  List< T >::List(const List< T >& rhs):
-    List()
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(const List< T, Alloc >& rhs):
+    List(Alloc(rhs.alloc_))
   {
     Node* current = rhs.fake_->next;
     while (current != rhs.fake_)
@@ -247,107 +278,111 @@ namespace demehin
     }
   }
 
-  template< typename T >
-  List< T >::List(List< T >&& rhs):
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(List< T, Alloc >&& rhs):
     fake_(std::exchange(rhs.fake_, nullptr)),
     tail_(std::exchange(rhs.tail_, nullptr)),
-    size_(std::exchange(rhs.size_, 0))
+    size_(std::exchange(rhs.size_, 0)),
+    alloc_(rhs.alloc_),
+    pool_(std::move(rhs.pool_))
   {}
 
-  template< typename T >
-  typename List< T >::Iter List< T >::begin() const noexcept
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::Iter List< T, Alloc >::begin() const noexcept
   {
     return Iter(fake_->next);
   }
 
-  template< typename T >
-  typename List< T >::Iter List< T >::end() const noexcept
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::Iter List< T, Alloc >::end() const noexcept
   {
     return Iter(fake_);
   }
 
-  template< typename T >
-  typename List< T >::cIter List< T >::cbegin() const noexcept
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::cIter List< T, Alloc >::cbegin() const noexcept
   {
     return cIter(fake_->next);
   }
 
-  template< typename T >
-  typename List< T >::cIter List< T >::cend() const noexcept
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::cIter List< T, Alloc >::cend() const noexcept
   {
     return cIter(fake_);
   }
 
-  template< typename T >
-  void List< T >::pop_front() noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::pop_front() noexcept
   {
     erase(cbegin());
   }
 
-  template< typename T >
-  void List< T >::pop_back() noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::pop_back() noexcept
   {
     erase(cIter(tail_));
   }
 
-  template< typename T >
-  void List< T >::push_back(const T& data)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::push_back(const T& data)
   {
     insert(cend(), data);
   }
 
-  template< typename T >
-  void List< T >::push_front(const T& data)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::push_front(const T& data)
   {
     insert(cbegin(), data);
   }
 
-  template< typename T >
-  const T& List< T >::front() const noexcept
+  template< typename T, typename Alloc >
+  const T& List< T, Alloc >::front() const noexcept
   {
     return fake_->next->data;
   }
 
-  template< typename T >
-  T& List< T >::front() noexcept
+  template< typename T, typename Alloc >
+  T& List< T, Alloc >::front() noexcept
   {
     return fake_->next->data;
   }
 
-  template< typename T >
-  const T& List< T >::back() const noexcept
+  template< typename T, typename Alloc >
+  const T& List< T, Alloc >::back() const noexcept
   {
     return tail_->data;
   }
 
-  template< typename T >
-  T& List< T >::back() noexcept
+  template< typename T, typename Alloc >
+  T& List< T, Alloc >::back() noexcept
   {
     return tail_->data;
   }
 
-  template< typename T >
-  size_t List< T >::size() const noexcept
+  template< typename T, typename Alloc >
+  size_t List< T, Alloc >::size() const noexcept
   {
     return size_;
   }
 
-  template< typename T >
-  bool List< T >::empty() const noexcept
+  template< typename T, typename Alloc >
+  bool List< T, Alloc >::empty() const noexcept
   {
     return size_ == 0;
   }
 
-  template< typename T >
-  void List< T >::swap(List< T >& other) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::swap(List< T, Alloc >& other) noexcept
   {
     std::swap(fake_, other.fake_);
     std::swap(tail_, other.tail_);
     std::swap(size_, other.size_);
+    std::swap(alloc_, other.alloc_);
+    std::swap(pool_, other.pool_);
   }
 
-  template< typename T >
-  void List< T >::fill(Iter first, Iter last, const T& value) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::fill(Iter first, Iter last, const T& value) noexcept
   {
     for (; first != last; ++first)
     {
@@ -355,33 +390,33 @@ namespace demehin
     }
   }
 
-  template < typename T >
-  void List< T >::splice(cIter pos, List< T >& other) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::splice(cIter pos, List< T, Alloc >& other) noexcept
   {
     splice(pos, other, other.cbegin(), other.cend());
   }
 
-  template < typename T >
-  void List< T >::splice(cIter pos, List< T >&& other) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::splice(cIter pos, List< T, Alloc >&& other) noexcept
   {
     splice(pos, other);
   }
 
-  template < typename T >
-  void List< T >::splice(cIter pos, List< T >& other, cIter it) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::splice(cIter pos, List< T, Alloc >& other, cIter it) noexcept
   {
     auto it2 = it;
     splice(pos, other, it, ++it2);
   }
 
-  template < typename T >
-  void List< T >::splice(cIter pos, List< T >&& other, cIter it) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::splice(cIter pos, List< T, Alloc >&& other, cIter it) noexcept
   {
     splice(pos, other, it);
   }
 
-  template < typename T >
-  void List< T >::splice(cIter pos, List< T >& other, cIter first, cIter last) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::splice(cIter pos, List< T, Alloc >& other, cIter first, cIter last) noexcept
   {
     if (first == last || other.empty() || &other == this)
     {
@@ -391,6 +426,7 @@ namespace demehin
     Node* posNode = pos.getNode();
     Node* firstNode = first.getNode();
     Node* lastNode = (last.getNode() != nullptr) ? last.getNode()->prev : other.tail_;
+    sharePool(other, firstNode, lastNode->next);
 
     size_t count = 0;
     for (auto it = first; it != last; it++)
@@ -416,6 +452,11 @@ namespace demehin
       other.tail_ = firstNode->prev;
     }
 
+    if (lastNode == other.tail_)
+    {
+      other.tail_ = firstNode->prev;
+    }
+
     firstNode->prev = posNode->prev;
     lastNode->next = posNode;
 
@@ -429,7 +470,7 @@ namespace demehin
     }
     posNode->prev = lastNode;
 
-    if (posNode == fake_->next)
+    if (posNode == fake_)
     {
       tail_ = lastNode;
     }
@@ -438,14 +479,14 @@ namespace demehin
     size_ += count;
   }
 
-  template < typename T >
-  void List< T >::splice(cIter pos, List< T >&& other, cIter first, cIter last) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::splice(cIter pos, List< T, Alloc >&& other, cIter first, cIter last) noexcept
   {
     splice(pos, other, first, last);
   }
 
-  template< typename T >
-  void List< T >::remove(const T& value) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::remove(const T& value) noexcept
   {
     for (auto it = cbegin(); it != cend();)
     {
@@ -460,9 +501,9 @@ namespace demehin
     }
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< typename UnaryPredicate >
-  void List< T >::removeIf(UnaryPredicate p) noexcept
+  void List< T, Alloc >::removeIf(UnaryPredicate p) noexcept
   {
     for (auto it = cbegin(); it != cend();)
     {
@@ -477,10 +518,10 @@ namespace demehin
     }
   }
 
-  template< typename T >
-  void List< T >::assign(size_t count, const T& value)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::assign(size_t count, const T& value)
   {
-    List< T > temp;
+    List< T, Alloc > temp;
     for (size_t i = 0; i < count; i++)
     {
       temp.push_back(value);
@@ -488,11 +529,11 @@ namespace demehin
     swap(temp);
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< typename InputIt >
-  void List< T >::assign(InputIt first, InputIt last)
+  void List< T, Alloc >::assign(InputIt first, InputIt last)
   {
-    List< T > temp;
+    List< T, Alloc > temp;
     for (auto it = first; it != last; it++)
     {
       temp.push_back(*it);
@@ -500,14 +541,14 @@ namespace demehin
     swap(temp);
   }
 
-  template< typename T >
-  void List< T >::assign(std::initializer_list< T > ilist)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::assign(std::initializer_list< T > ilist)
   {
     assign(ilist.begin(), ilist.end());
   }
 
-  template< typename T >
-  typename List< T >::Iter List< T >::erase(cIter pos) noexcept
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::Iter List< T, Alloc >::erase(cIter pos) noexcept
   {
     Node* todelete = pos.getNode();
     if (todelete == fake_)
@@ -527,12 +568,12 @@ namespace demehin
       fake_->next = todelete->next;
     }
     size_--;
-    delete todelete;
+    destroyNode(todelete);
     return toreturn;
   }
 
-  template< typename T >
-  typename List< T >::Iter List< T >::erase(cIter first, cIter last) noexcept
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::Iter List< T, Alloc >::erase(cIter first, cIter last) noexcept
   {
     Iter toreturn;
     for (auto it = first; it != last; it++)
@@ -542,11 +583,11 @@ namespace demehin
     return toreturn;
   }
 
-  template< typename T >
-  typename List< T >::Iter List< T >::insert(cIter pos, const T& value)
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::Iter List< T, Alloc >::insert(cIter pos, const T& value)
   {
     Node* posNode = pos.getNode() ? pos.getNode() : fake_;
-    Node* newNode = new Node(value, posNode->prev, posNode);
+    Node* newNode = createNode(value, posNode->prev, posNode);
     posNode->prev->next = newNode;
     posNode->prev = newNode;
 
@@ -562,15 +603,15 @@ namespace demehin
     return Iter(newNode);
   }
 
-  template< typename T >
-  typename List< T >::Iter List< T >::insert(cIter pos, T&& value)
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::Iter List< T, Alloc >::insert(cIter pos, T&& value)
   {
     T temp_val = std::move(value);
     return insert(pos, temp_val);
   }
 
-  template< typename T >
-  typename List< T >::Iter List< T >::insert(cIter pos, size_t count, const T& value)
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::Iter List< T, Alloc >::insert(cIter pos, size_t count, const T& value)
   {
     if (count == 0)
     {
@@ -580,15 +621,15 @@ namespace demehin
     Iter toreturn = insert(pos, value);
     if (count != 1)
     {
-      List< T > values(--count, value);
+      List< T, Alloc > values(--count, value);
       splice(pos, values);
     }
     return toreturn;
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< typename InputIt >
-  typename List< T >::Iter List< T >::insert(cIter pos, InputIt first, InputIt last)
+  typename List< T, Alloc >::Iter List< T, Alloc >::insert(cIter pos, InputIt first, InputIt last)
   {
     if (first == last)
     {
@@ -596,13 +637,13 @@ namespace demehin
     }
 
     Iter result = insert(pos, *first);
-    List< T > tempList(++first, last);
+    List< T, Alloc > tempList(++first, last);
     splice(pos, tempList);
     return result;
   }
 
-  template< typename T >
-  typename List< T >::Iter List< T >::insert(cIter pos, std::initializer_list< T > ilist)
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::Iter List< T, Alloc >::insert(cIter pos, std::initializer_list< T > ilist)
   {
     if (ilist.size() == 0)
     {
@@ -612,8 +653,80 @@ namespace demehin
     return insert(pos, ilist.begin(), ilist.end());
   }
 
-  template< typename T >
-  void List< T >::reverse() noexcept
+  template< typename T, typename Alloc >
+  typename List< T, Alloc >::Node* List< T, Alloc >::createNode(const T& value, Node* prev, Node* next)
+  {
+    Node* place = nullptr;
+    if (!pool_ && size_ < loose_limit)
+    {
+      place = pool_type::allocateSingle(alloc_);
+    }
+    else
+    {
+      if (!pool_)
+      {
+        createPool();
+      }
+      place = pool_->allocate();
+    }
+    return new (place) Node(value, prev, next);
+  }
+
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::destroyNode(Node* node) noexcept
+  {
+    node->~Node();
+    if (pool_)
+    {
+      pool_->deallocate(node);
+    }
+    else
+    {
+      pool_type::deallocateSingle(alloc_, node);
+    }
+  }
+
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::createPool()
+  {
+    pool_ = std::allocate_shared< pool_type >(alloc_, alloc_);
+    adoptNodes(*pool_);
+  }
+
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::adoptNodes(pool_type& pool) noexcept
+  {
+    for (Node* node = fake_->next; node != fake_; node = node->next)
+    {
+      pool.adopt(node);
+    }
+  }
+
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::sharePool(List< T, Alloc >& other, Node* first, Node* last) noexcept
+  {
+    if (!other.pool_)
+    {
+      if (pool_)
+      {
+        for (Node* node = first; node != last; node = node->next)
+        {
+          pool_->adopt(node);
+        }
+      }
+      return;
+    }
+    if (!pool_)
+    {
+      adoptNodes(*other.pool_);
+      pool_ = other.pool_;
+      return;
+    }
+    pool_type::merge(pool_, other.pool_);
+  }
+
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::reverse() noexcept
   {
     if (size() <= 1)
     {
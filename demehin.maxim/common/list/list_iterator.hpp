@@ -6,7 +6,7 @@
 
 namespace demehin
 {
-  template< typename T >
+  template< typename T, typename Alloc >
   class List;
 
   template< typename T, bool isConst >
@@ -14,7 +14,8 @@ namespace demehin
   {
     friend class ListIterator< T, true >;
     friend class ListIterator< T, false >;
-    friend class List< T >;
+    template< typename U, typename Alloc >
+    friend class List;
   public:
     using this_t = ListIterator< T, isConst >;
     using Value = typename std::conditional< isConst, const T&, T& >::type;
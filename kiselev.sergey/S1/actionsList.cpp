@@ -1,48 +1,83 @@
 #include "actionsList.hpp"
-#include <iterator>
 #include <limits>
 #include <stdexcept>
 
 namespace
 {
-  size_t searchMax(const kiselev::list& list)
+  using cursor = std::pair< kiselev::numberList::ConstIterator, kiselev::numberList::ConstIterator >;
+  using cursorList = kiselev::List< cursor >;
+
+  bool isExhausted(const cursor& cur) noexcept
+  {
+    return cur.first == cur.second;
+  }
+
+  cursorList makeCursors(const kiselev::list& list)
+  {
+    cursorList cursors;
+    for (auto it = list.cbegin(); it != list.cend(); ++it)
+    {
+      if (!it->second.empty())
+      {
+        cursors.pushBack(cursor(it->second.cbegin(), it->second.cend()));
+      }
+    }
+    return cursors;
+  }
+
+  void nextColumn(cursorList& cursors) noexcept
   {
-    size_t max = 0;
-    for (auto begin = list.cbegin(); begin != list.cend(); ++begin)
+    for (auto it = cursors.begin(); it != cursors.end(); ++it)
     {
-      max = begin->second.size() == 0 ? max : std::max(max, begin->second.size());
+      ++it->first;
     }
-    return max;
+    cursors.remove_if(isExhausted);
   }
 
-  unsigned long long checkedSum(unsigned long long sum, unsigned long long number)
+  bool addChecked(unsigned long long& sum, unsigned long long number) noexcept
   {
     const unsigned long long max = std::numeric_limits< unsigned long long >::max();
     if (max - number < sum)
     {
-      throw std::overflow_error("Overflow for unsigned long long");
+      return false;
     }
     sum += number;
-    return sum;
+    return true;
+  }
+
+  bool columnSum(const cursorList& cursors, unsigned long long& sum) noexcept
+  {
+    sum = 0;
+    for (auto it = cursors.cbegin(); it != cursors.cend(); ++it)
+    {
+      if (!addChecked(sum, *it->first))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::ostream& outputColumn(std::ostream& output, const cursorList& cursors)
+  {
+    output << *cursors.front().first;
+    for (auto it = ++cursors.cbegin(); it != cursors.cend(); ++it)
+    {
+      output << " " << *it->first;
+    }
+    return output;
   }
 }
+
 kiselev::numberList kiselev::calculateSum(const list& list)
 {
-  auto it = list.cbegin();
   kiselev::numberList listSum;
-  for (size_t i = 0; i < searchMax(list); ++i)
+  for (cursorList cursors = makeCursors(list); !cursors.empty(); nextColumn(cursors))
   {
     unsigned long long sum = 0;
-    it = list.cbegin();
-    for (; it != list.cend(); ++it)
+    if (!columnSum(cursors, sum))
     {
-      auto nit = it->second.cbegin();
-      if (i >= it->second.size())
-      {
-        continue;
-      }
-      std::advance(nit, i);
-      sum = checkedSum(sum, *nit);
+      throw std::overflow_error("Overflow for unsigned long long");
     }
     listSum.pushBack(sum);
   }
@@ -71,22 +106,29 @@ std::ostream& kiselev::outputName(std::ostream& output, const list& list)
 
 std::ostream& kiselev::outputNumbers(std::ostream& output, const list& list)
 {
-  auto it = list.cbegin();
-  for (size_t i = 0; i < searchMax(list); ++i)
+  for (cursorList cursors = makeCursors(list); !cursors.empty(); nextColumn(cursors))
   {
-    it = list.cbegin();
-    kiselev::numberList numbers;
-    for (; it != list.cend(); ++it)
+    outputColumn(output, cursors) << "\n";
+  }
+  return output;
+}
+
+std::ostream& kiselev::outputColumns(std::ostream& output, const list& list, numberList& sums)
+{
+  bool overflow = false;
+  for (cursorList cursors = makeCursors(list); !cursors.empty(); nextColumn(cursors))
+  {
+    outputColumn(output, cursors) << "\n";
+    unsigned long long sum = 0;
+    overflow = overflow || !columnSum(cursors, sum);
+    if (!overflow)
     {
-      auto nit = it->second.cbegin();
-      if (i >= it->second.size())
-      {
-        continue;
-      }
-      std::advance(nit, i);
-      numbers.pushBack(*nit);
+      sums.pushBack(sum);
     }
-    outputNumber(output, numbers) << "\n";
+  }
+  if (overflow)
+  {
+    throw std::overflow_error("Overflow for unsigned long long");
   }
   return output;
 }
@@ -108,7 +150,7 @@ kiselev::list kiselev::createList(std::istream& input)
       numbers.pushBack(number);
     }
     input.clear();
-    list.pushBack(pair(name, numbers));
+    list.pushBack(pair(name, std::move(numbers)));
   }
   return list;
 }
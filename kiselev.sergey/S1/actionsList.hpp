@@ -2,10 +2,11 @@
 #define ACTIONSLIST_HPP
 #include <iostream>
 #include "list.hpp"
+#include "unrolledList.hpp"
 
 namespace kiselev
 {
-  using numberList = List< unsigned long long >;
+  using numberList = UnrolledList< unsigned long long >;
   using pair = std::pair< std::string, numberList >;
   using list = List< pair >;
   list createList(std::istream& input);
@@ -13,5 +14,6 @@ namespace kiselev
   std::ostream& outputNumber(std::ostream& output, const numberList& list);
   std::ostream& outputName(std::ostream& output, const list& list);
   std::ostream& outputNumbers(std::ostream& output, const list& list);
+  std::ostream& outputColumns(std::ostream& output, const list& list, numberList& sums);
 }
 #endif
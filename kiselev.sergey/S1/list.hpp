@@ -91,6 +91,8 @@ namespace kiselev
     Node< T >* head_;
     Node< T >* end_;
     size_t size_;
+
+    Iterator insertNode(ConstIterator, Node< T >*);
   };
 
   template< typename T >
@@ -515,7 +517,18 @@ namespace kiselev
   template< typename T >
   typename List< T >::Iterator List< T >::insert(ConstIterator position, const T& data)
   {
-    Node< T >* node = new Node< T >{ data, nullptr, nullptr };
+    return insertNode(position, new Node< T >{ data, nullptr, nullptr });
+  }
+
+  template< typename T >
+  typename List< T >::Iterator List< T >::insert(ConstIterator position, T&& data)
+  {
+    return insertNode(position, new Node< T >{ std::move(data), nullptr, nullptr });
+  }
+
+  template< typename T >
+  typename List< T >::Iterator List< T >::insertNode(ConstIterator position, Node< T >* node)
+  {
     if (empty())
     {
       try
@@ -552,12 +565,6 @@ namespace kiselev
     return Iterator(node);
   }
 
-  template< typename T >
-  typename List< T >::Iterator List< T >::insert(ConstIterator position, T&& data)
-  {
-    return insert(position, data);
-  }
-
   template< typename T >
   typename List< T >::Iterator List< T >::insert(ConstIterator position, size_t n, const T& data)
   {
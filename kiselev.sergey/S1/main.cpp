@@ -16,8 +16,8 @@ int main()
       std::cout << "0\n";
       return 0;
     }
-    outputNumbers(std::cout, listPairs);
-    kiselev::numberList sum = calculateSum(listPairs);
+    kiselev::numberList sum;
+    outputColumns(std::cout, listPairs, sum);
     outputNumber(std::cout, sum) << "\n";
     return 0;
   }
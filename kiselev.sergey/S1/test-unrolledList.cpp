@@ -0,0 +1,236 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <boost/test/unit_test.hpp>
+#include "unrolledList.hpp"
+
+using kiselev::UnrolledList;
+namespace
+{
+  using SmallList = UnrolledList< int, 4 >;
+
+  void createList(SmallList& list, int count)
+  {
+    for (int i = 0; i < count; ++i)
+    {
+      list.pushBack(i);
+    }
+  }
+  std::string outputList(const SmallList& list)
+  {
+    std::ostringstream out;
+    for (SmallList::ConstIterator it = list.cbegin(); it != list.cend(); ++it)
+    {
+      out << *it;
+    }
+    return out.str();
+  }
+  bool equalTo(const SmallList& list, const std::list< int >& expected)
+  {
+    return list.size() == expected.size() && std::equal(expected.cbegin(), expected.cend(), list.cbegin());
+  }
+  size_t countChunks(const SmallList& list)
+  {
+    size_t count = 0;
+    const int* previous = nullptr;
+    for (SmallList::ConstIterator it = list.cbegin(); it != list.cend(); ++it)
+    {
+      if (!previous || std::addressof(*it) != previous + 1)
+      {
+        ++count;
+      }
+      previous = std::addressof(*it);
+    }
+    return count;
+  }
+}
+BOOST_AUTO_TEST_SUITE(unrolledList)
+
+BOOST_AUTO_TEST_CASE(push_pop_and_iterate)
+{
+  SmallList list;
+  BOOST_TEST(list.empty());
+  BOOST_TEST((list.cbegin() == list.cend()));
+  createList(list, 10);
+  list.pushFront(9);
+  BOOST_TEST(list.size() == 11);
+  BOOST_TEST(outputList(list) == "90123456789");
+  BOOST_TEST(list.front() == 9);
+  BOOST_TEST(list.back() == 9);
+  list.popFront();
+  list.popBack();
+  BOOST_TEST(outputList(list) == "012345678");
+  SmallList::ConstIterator it = list.cend();
+  --it;
+  BOOST_TEST(*it == 8);
+  SmallList copy(list);
+  BOOST_TEST((copy == list));
+  SmallList moved(std::move(copy));
+  BOOST_TEST((moved == list));
+  BOOST_TEST(copy.empty());
+  BOOST_TEST((UnrolledList< int >{ 1, 2, 3 } < UnrolledList< int >{ 1, 3 }));
+}
+
+BOOST_AUTO_TEST_CASE(insert_and_erase)
+{
+  SmallList list;
+  createList(list, 8);
+  SmallList::ConstIterator pos = list.cbegin();
+  std::advance(pos, 2);
+  SmallList::Iterator inserted = list.insert(pos, 7);
+  BOOST_TEST(*inserted == 7);
+  BOOST_TEST(outputList(list) == "017234567");
+  list.insert(list.cend(), { 1, 2 });
+  list.insert(list.cbegin(), static_cast< size_t >(2), 5);
+  BOOST_TEST(outputList(list) == "5501723456712");
+  pos = list.cbegin();
+  std::advance(pos, 3);
+  SmallList::ConstIterator last = pos;
+  std::advance(last, 4);
+  SmallList::Iterator next = list.erase(pos, last);
+  BOOST_TEST(*next == 4);
+  BOOST_TEST(outputList(list) == "550456712");
+  list.remove(5);
+  BOOST_TEST(outputList(list) == "046712");
+}
+
+BOOST_AUTO_TEST_CASE(splice)
+{
+  SmallList list1;
+  createList(list1, 5);
+  SmallList list2;
+  createList(list2, 3);
+  list1.splice(++list1.cbegin(), list2);
+  BOOST_TEST(outputList(list1) == "00121234");
+  BOOST_TEST(list2.empty());
+
+  SmallList list3;
+  createList(list3, 4);
+  SmallList list4;
+  createList(list4, 3);
+  list3.splice(list3.cbegin(), list4, ++list4.cbegin());
+  BOOST_TEST(outputList(list3) == "10123");
+  BOOST_TEST(outputList(list4) == "02");
+
+  SmallList list5;
+  createList(list5, 4);
+  SmallList list6;
+  createList(list6, 3);
+  list5.splice(list5.cend(), std::move(list6), ++list6.cbegin(), list6.cend());
+  BOOST_TEST(outputList(list5) == "012312");
+  BOOST_TEST(outputList(list6) == "0");
+}
+
+BOOST_AUTO_TEST_CASE(reverse_and_remove_if)
+{
+  SmallList list;
+  createList(list, 10);
+  list.reverse();
+  BOOST_TEST(outputList(list) == "9876543210");
+  list.remove_if([](int value)
+  {
+    return value % 3 != 0;
+  });
+  BOOST_TEST(outputList(list) == "9630");
+  BOOST_TEST(list.size() == 4);
+}
+
+BOOST_AUTO_TEST_CASE(erase_keeps_chunks_half_full)
+{
+  SmallList list;
+  createList(list, 400);
+  for (SmallList::ConstIterator it = list.cbegin(); it != list.cend();)
+  {
+    it = (*it % 4 == 0) ? std::next(it) : list.erase(it);
+  }
+  BOOST_TEST(list.size() == 100);
+  BOOST_TEST(countChunks(list) <= list.size() / 2 + 1);
+  BOOST_TEST(list.front() == 0);
+  BOOST_TEST(list.back() == 396);
+
+  SmallList filtered;
+  createList(filtered, 400);
+  filtered.remove_if([](int value)
+  {
+    return value % 8 != 0;
+  });
+  BOOST_TEST(filtered.size() == 50);
+  BOOST_TEST(countChunks(filtered) <= filtered.size() / 2 + 1);
+  int expected = 0;
+  for (SmallList::ConstIterator it = filtered.cbegin(); it != filtered.cend(); ++it, expected += 8)
+  {
+    BOOST_TEST(*it == expected);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(matches_std_list)
+{
+  std::srand(42);
+  SmallList list;
+  std::list< int > expected;
+  for (int step = 0; step < 5000; ++step)
+  {
+    int value = std::rand() % 100;
+    size_t index = expected.empty() ? 0 : std::rand() % (expected.size() + 1);
+    SmallList::ConstIterator pos = list.cbegin();
+    std::list< int >::const_iterator expectedPos = expected.cbegin();
+    std::advance(pos, index);
+    std::advance(expectedPos, index);
+    switch (std::rand() % 6)
+    {
+    case 0:
+    case 1:
+      list.insert(pos, value);
+      expected.insert(expectedPos, value);
+      break;
+    case 2:
+      if (pos != list.cend())
+      {
+        list.erase(pos);
+        expected.erase(expectedPos);
+      }
+      break;
+    case 3:
+    {
+      SmallList other;
+      std::list< int > expectedOther;
+      for (int i = std::rand() % 9; i > 0; --i)
+      {
+        other.pushBack(i);
+        expectedOther.push_back(i);
+      }
+      size_t from = std::rand() % (expectedOther.size() + 1);
+      size_t to = from + std::rand() % (expectedOther.size() - from + 1);
+      SmallList::ConstIterator first = other.cbegin();
+      std::list< int >::const_iterator expectedFirst = expectedOther.cbegin();
+      std::advance(first, from);
+      std::advance(expectedFirst, from);
+      SmallList::ConstIterator last = first;
+      std::list< int >::const_iterator expectedLast = expectedFirst;
+      std::advance(last, to - from);
+      std::advance(expectedLast, to - from);
+      list.splice(pos, other, first, last);
+      expected.splice(expectedPos, expectedOther, expectedFirst, expectedLast);
+      BOOST_TEST(equalTo(other, expectedOther));
+      break;
+    }
+    case 4:
+      list.remove(value % 10);
+      expected.remove(value % 10);
+      break;
+    default:
+      if (step % 50 == 0)
+      {
+        list.reverse();
+        expected.reverse();
+      }
+    }
+    BOOST_REQUIRE(equalTo(list, expected));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
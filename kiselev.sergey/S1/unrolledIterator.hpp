@@ -0,0 +1,140 @@
+#ifndef UNROLLEDITERATOR_HPP
+#define UNROLLEDITERATOR_HPP
+#include <cassert>
+#include <iterator>
+#include <memory>
+#include "unrolledNode.hpp"
+namespace kiselev
+{
+  template< typename T, size_t N >
+  class UnrolledList;
+  namespace detail
+  {
+    template< typename T, size_t N, bool IsConst >
+    class UnrolledIterator: public std::iterator< std::bidirectional_iterator_tag, T >
+    {
+    public:
+      using reference = std::conditional_t< IsConst, const T&, T& >;
+      using pointer = std::conditional_t< IsConst, const T*, T* >;
+
+      UnrolledIterator();
+      template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > = 0 >
+      UnrolledIterator(const UnrolledIterator< T, N, OtherIsConst >& other):
+        chunk_(other.chunk_),
+        index_(other.index_)
+      {}
+      template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > = 0 >
+      UnrolledIterator< T, N, IsConst >& operator=(const UnrolledIterator< T, N, OtherIsConst >& other);
+
+      UnrolledIterator< T, N, IsConst >& operator++() noexcept;
+      UnrolledIterator< T, N, IsConst > operator++(int) noexcept;
+
+      UnrolledIterator< T, N, IsConst >& operator--() noexcept;
+      UnrolledIterator< T, N, IsConst > operator--(int) noexcept;
+
+      reference operator*() const noexcept;
+      pointer operator->() const noexcept;
+
+      bool operator==(const UnrolledIterator< T, N, IsConst >&) const noexcept;
+      bool operator!=(const UnrolledIterator< T, N, IsConst >&) const noexcept;
+
+    private:
+      ChunkBase* chunk_;
+      size_t index_;
+      UnrolledIterator(ChunkBase* chunk, size_t index);
+      friend class UnrolledIterator< T, N, !IsConst >;
+      friend class UnrolledList< T, N >;
+    };
+
+    template< typename T, size_t N, bool IsConst >
+    UnrolledIterator< T, N, IsConst >::UnrolledIterator():
+      chunk_(nullptr),
+      index_(0)
+    {}
+
+    template< typename T, size_t N, bool IsConst >
+    UnrolledIterator< T, N, IsConst >::UnrolledIterator(ChunkBase* chunk, size_t index):
+      chunk_(chunk),
+      index_(index)
+    {}
+
+    template< typename T, size_t N, bool IsConst >
+    template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > >
+    UnrolledIterator< T, N, IsConst >& UnrolledIterator< T, N, IsConst >::operator=(
+      const UnrolledIterator< T, N, OtherIsConst >& other)
+    {
+      chunk_ = other.chunk_;
+      index_ = other.index_;
+      return *this;
+    }
+
+    template< typename T, size_t N, bool IsConst >
+    UnrolledIterator< T, N, IsConst >& UnrolledIterator< T, N, IsConst >::operator++() noexcept
+    {
+      assert(chunk_ != nullptr);
+      if (++index_ == chunk_->size)
+      {
+        chunk_ = chunk_->next;
+        index_ = 0;
+      }
+      return *this;
+    }
+
+    template< typename T, size_t N, bool IsConst >
+    UnrolledIterator< T, N, IsConst > UnrolledIterator< T, N, IsConst >::operator++(int) noexcept
+    {
+      assert(chunk_ != nullptr);
+      UnrolledIterator< T, N, IsConst > result(*this);
+      ++(*this);
+      return result;
+    }
+
+    template< typename T, size_t N, bool IsConst >
+    UnrolledIterator< T, N, IsConst >& UnrolledIterator< T, N, IsConst >::operator--() noexcept
+    {
+      assert(chunk_ != nullptr);
+      if (index_ == 0)
+      {
+        chunk_ = chunk_->prev;
+        index_ = chunk_->size;
+      }
+      --index_;
+      return *this;
+    }
+
+    template< typename T, size_t N, bool IsConst >
+    UnrolledIterator< T, N, IsConst > UnrolledIterator< T, N, IsConst >::operator--(int) noexcept
+    {
+      assert(chunk_ != nullptr);
+      UnrolledIterator< T, N, IsConst > result(*this);
+      --(*this);
+      return result;
+    }
+
+    template< typename T, size_t N, bool IsConst >
+    typename UnrolledIterator< T, N, IsConst >::reference UnrolledIterator< T, N, IsConst >::operator*() const noexcept
+    {
+      assert(chunk_ != nullptr && index_ < chunk_->size);
+      return static_cast< Chunk< T, N >* >(chunk_)->data()[index_];
+    }
+
+    template< typename T, size_t N, bool IsConst >
+    typename UnrolledIterator< T, N, IsConst >::pointer UnrolledIterator< T, N, IsConst >::operator->() const noexcept
+    {
+      return std::addressof(**this);
+    }
+
+    template< typename T, size_t N, bool IsConst >
+    bool UnrolledIterator< T, N, IsConst >::operator==(const UnrolledIterator< T, N, IsConst >& it) const noexcept
+    {
+      return chunk_ == it.chunk_ && index_ == it.index_;
+    }
+
+    template< typename T, size_t N, bool IsConst >
+    bool UnrolledIterator< T, N, IsConst >::operator!=(const UnrolledIterator< T, N, IsConst >& it) const noexcept
+    {
+      return !(it == *this);
+    }
+  }
+}
+#endif
@@ -0,0 +1,800 @@
+#ifndef UNROLLEDLIST_HPP
+#define UNROLLEDLIST_HPP
+#include <algorithm>
+#include <cassert>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+#include "unrolledIterator.hpp"
+#include "unrolledNode.hpp"
+
+namespace kiselev
+{
+  template< typename T, size_t N = 32 >
+  class UnrolledList
+  {
+  public:
+    static_assert(N >= 2, "Chunk must hold at least two elements");
+
+    using Iterator = detail::UnrolledIterator< T, N, false >;
+    using ConstIterator = detail::UnrolledIterator< T, N, true >;
+
+    UnrolledList();
+    UnrolledList(const UnrolledList< T, N >&);
+    UnrolledList(UnrolledList< T, N >&&) noexcept;
+    UnrolledList(size_t, const T&);
+    template< typename InputIterator >
+    UnrolledList(InputIterator first, InputIterator last);
+    UnrolledList(std::initializer_list< T >);
+    ~UnrolledList();
+
+    UnrolledList< T, N >& operator=(const UnrolledList< T, N >&);
+    UnrolledList< T, N >& operator=(UnrolledList< T, N >&&) noexcept;
+    UnrolledList< T, N >& operator=(std::initializer_list< T >);
+
+    bool operator==(const UnrolledList< T, N >&) const;
+    bool operator!=(const UnrolledList< T, N >&) const;
+    bool operator<(const UnrolledList< T, N >&) const;
+    bool operator>(const UnrolledList< T, N >&) const;
+    bool operator<=(const UnrolledList< T, N >&) const;
+    bool operator>=(const UnrolledList< T, N >&) const;
+
+    Iterator begin() noexcept;
+    ConstIterator cbegin() const noexcept;
+    Iterator end() noexcept;
+    ConstIterator cend() const noexcept;
+
+    bool empty() const noexcept;
+    size_t size() const noexcept;
+
+    T& front() noexcept;
+    const T& front() const noexcept;
+    T& back() noexcept;
+    const T& back() const noexcept;
+
+    void pushBack(const T&);
+    void pushBack(T&&);
+    void pushFront(const T&);
+    void pushFront(T&&);
+
+    void popBack() noexcept;
+    void popFront() noexcept;
+
+    void clear() noexcept;
+    void swap(UnrolledList< T, N >&) noexcept;
+
+    void assign(size_t, const T&);
+    template< typename InputIterator >
+    void assign(InputIterator first, InputIterator last);
+    void assign(std::initializer_list< T >);
+
+    Iterator erase(ConstIterator) noexcept;
+    Iterator erase(ConstIterator first, ConstIterator last) noexcept;
+
+    Iterator insert(ConstIterator, const T&);
+    Iterator insert(ConstIterator, T&&);
+    Iterator insert(ConstIterator, size_t, const T&);
+    template< typename InputIterator >
+    Iterator insert(ConstIterator pos, InputIterator first, InputIterator last);
+    Iterator insert(ConstIterator, std::initializer_list< T >);
+
+    void remove(const T&) noexcept;
+    template< typename Predicate >
+    void remove_if(Predicate) noexcept;
+
+    void splice(ConstIterator, UnrolledList< T, N >&);
+    void splice(ConstIterator, UnrolledList< T, N >&&);
+    void splice(ConstIterator position, UnrolledList< T, N >&, ConstIterator i);
+    void splice(ConstIterator position, UnrolledList< T, N >&&, ConstIterator i);
+    void splice(ConstIterator pos, UnrolledList< T, N >&, ConstIterator first, ConstIterator last);
+    void splice(ConstIterator pos, UnrolledList< T, N >&&, ConstIterator first, ConstIterator last);
+    void reverse() noexcept;
+
+  private:
+    using ChunkType = Chunk< T, N >;
+
+    ChunkBase* end_;
+    size_t size_;
+
+    static ChunkType* chunk(ChunkBase*) noexcept;
+    static void moveElements(ChunkType* to, size_t toIndex, ChunkType* from, size_t fromIndex, size_t count) noexcept;
+    void makeEnd();
+    ChunkType* newChunkBefore(ChunkBase*);
+    void deleteChunk(ChunkBase*) noexcept;
+    ChunkBase* splitAt(ChunkBase*, size_t);
+    bool mergeWithNext(ChunkBase*) noexcept;
+    void balanceWithNext(ChunkBase*) noexcept;
+    ChunkBase* balanceWithPrev(ChunkBase*, size_t&) noexcept;
+    template< typename... Args >
+    Iterator emplace(ConstIterator, Args&&...);
+    Iterator spliceChunks(ConstIterator pos, UnrolledList< T, N >&, ConstIterator first, ConstIterator last);
+  };
+
+  template< typename T, size_t N >
+  UnrolledList< T, N >::UnrolledList():
+    end_(nullptr),
+    size_(0)
+  {}
+
+  template< typename T, size_t N >
+  UnrolledList< T, N >::UnrolledList(const UnrolledList< T, N >& list):
+    UnrolledList()
+  {
+    for (ConstIterator it = list.cbegin(); it != list.cend(); ++it)
+    {
+      pushBack(*it);
+    }
+  }
+
+  template< typename T, size_t N >
+  UnrolledList< T, N >::UnrolledList(UnrolledList< T, N >&& list) noexcept:
+    end_(std::exchange(list.end_, nullptr)),
+    size_(std::exchange(list.size_, 0))
+  {}
+
+  template< typename T, size_t N >
+  UnrolledList< T, N >::UnrolledList(size_t count, const T& data):
+    UnrolledList()
+  {
+    for (size_t i = 0; i < count; ++i)
+    {
+      pushBack(data);
+    }
+  }
+
+  template< typename T, size_t N >
+  template< typename InputIterator >
+  UnrolledList< T, N >::UnrolledList(InputIterator first, InputIterator last):
+    UnrolledList()
+  {
+    for (; first != last; ++first)
+    {
+      pushBack(*first);
+    }
+  }
+
+  template< typename T, size_t N >
+  UnrolledList< T, N >::UnrolledList(std::initializer_list< T > il):
+    UnrolledList(il.begin(), il.end())
+  {}
+
+  template< typename T, size_t N >
+  UnrolledList< T, N >::~UnrolledList()
+  {
+    clear();
+    delete end_;
+  }
+
+  template< typename T, size_t N >
+  UnrolledList< T, N >& UnrolledList< T, N >::operator=(const UnrolledList< T, N >& list)
+  {
+    UnrolledList< T, N > cpy(list);
+    swap(cpy);
+    return *this;
+  }
+
+  template< typename T, size_t N >
+  UnrolledList< T, N >& UnrolledList< T, N >::operator=(UnrolledList< T, N >&& list) noexcept
+  {
+    UnrolledList< T, N > temp(std::move(list));
+    swap(temp);
+    return *this;
+  }
+
+  template< typename T, size_t N >
+  UnrolledList< T, N >& UnrolledList< T, N >::operator=(std::initializer_list< T > il)
+  {
+    UnrolledList< T, N > temp(il);
+    swap(temp);
+    return *this;
+  }
+
+  template< typename T, size_t N >
+  bool UnrolledList< T, N >::operator==(const UnrolledList< T, N >& list) const
+  {
+    return size_ == list.size_ && std::equal(cbegin(), cend(), list.cbegin());
+  }
+
+  template< typename T, size_t N >
+  bool UnrolledList< T, N >::operator!=(const UnrolledList< T, N >& list) const
+  {
+    return !(*this == list);
+  }
+
+  template< typename T, size_t N >
+  bool UnrolledList< T, N >::operator<(const UnrolledList< T, N >& list) const
+  {
+    size_t min = std::min(size_, list.size_);
+    ConstIterator thisIt = cbegin();
+    ConstIterator otherIt = list.cbegin();
+    for (size_t i = 0; i < min; ++i, ++thisIt, ++otherIt)
+    {
+      if (*thisIt != *otherIt)
+      {
+        return *thisIt < *otherIt;
+      }
+    }
+    return false;
+  }
+
+  template< typename T, size_t N >
+  bool UnrolledList< T, N >::operator>(const UnrolledList< T, N >& list) const
+  {
+    return list < *this;
+  }
+
+  template< typename T, size_t N >
+  bool UnrolledList< T, N >::operator<=(const UnrolledList< T, N >& list) const
+  {
+    return !(*this > list);
+  }
+
+  template< typename T, size_t N >
+  bool UnrolledList< T, N >::operator>=(const UnrolledList< T, N >& list) const
+  {
+    return !(*this < list);
+  }
+
+  template< typename T, size_t N >
+  typename UnrolledList< T, N >::Iterator UnrolledList< T, N >::begin() noexcept
+  {
+    return Iterator(end_ ? end_->next : nullptr, 0);
+  }
+
+  template< typename T, size_t N >
+  typename UnrolledList< T, N >::ConstIterator UnrolledList< T, N >::cbegin() const noexcept
+  {
+    return ConstIterator(end_ ? end_->next : nullptr, 0);
+  }
+
+  template< typename T, size_t N >
+  typename UnrolledList< T, N >::Iterator UnrolledList< T, N >::end() noexcept
+  {
+    return Iterator(end_, 0);
+  }
+
+  template< typename T, size_t N >
+  typename UnrolledList< T, N >::ConstIterator UnrolledList< T, N >::cend() const noexcept
+  {
+    return ConstIterator(end_, 0);
+  }
+
+  template< typename T, size_t N >
+  bool UnrolledList< T, N >::empty() const noexcept
+  {
+    return size_ == 0;
+  }
+
+  template< typename T, size_t N >
+  size_t UnrolledList< T, N >::size() const noexcept
+  {
+    return size_;
+  }
+
+  template< typename T, size_t N >
+  T& UnrolledList< T, N >::front() noexcept
+  {
+    assert(!empty());
+    return chunk(end_->next)->data()[0];
+  }
+
+  template< typename T, size_t N >
+  const T& UnrolledList< T, N >::front() const noexcept
+  {
+    assert(!empty());
+    return chunk(end_->next)->data()[0];
+  }
+
+  template< typename T, size_t N >
+  T& UnrolledList< T, N >::back() noexcept
+  {
+    assert(!empty());
+    return chunk(end_->prev)->data()[end_->prev->size - 1];
+  }
+
+  template< typename T, size_t N >
+  const T& UnrolledList< T, N >::back() const noexcept
+  {
+    assert(!empty());
+    return chunk(end_->prev)->data()[end_->prev->size - 1];
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::pushBack(const T& data)
+  {
+    emplace(cend(), data);
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::pushBack(T&& data)
+  {
+    emplace(cend(), std::move(data));
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::pushFront(const T& data)
+  {
+    emplace(cbegin(), data);
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::pushFront(T&& data)
+  {
+    emplace(cbegin(), std::move(data));
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::popBack() noexcept
+  {
+    assert(!empty());
+    erase(ConstIterator(end_->prev, end_->prev->size - 1));
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::popFront() noexcept
+  {
+    assert(!empty());
+    erase(cbegin());
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::clear() noexcept
+  {
+    if (!end_)
+    {
+      return;
+    }
+    while (end_->next != end_)
+    {
+      ChunkType* current = chunk(end_->next);
+      T* data = current->data();
+      for (size_t i = 0; i < current->size; ++i)
+      {
+        data[i].~T();
+      }
+      deleteChunk(current);
+    }
+    size_ = 0;
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::swap(UnrolledList< T, N >& list) noexcept
+  {
+    std::swap(end_, list.end_);
+    std::swap(size_, list.size_);
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::assign(size_t count, const T& data)
+  {
+    UnrolledList< T, N > temp(count, data);
+    swap(temp);
+  }
+
+  template< typename T, size_t N >
+  template< typename InputIterator >
+  void UnrolledList< T, N >::assign(InputIterator first, InputIterator last)
+  {
+    UnrolledList< T, N > temp(first, last);
+    swap(temp);
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::assign(std::initializer_list< T > il)
+  {
+    UnrolledList< T, N > temp(il);
+    swap(temp);
+  }
+
+  template< typename T, size_t N >
+  typename UnrolledList< T, N >::Iterator UnrolledList< T, N >::erase(ConstIterator position) noexcept
+  {
+    ChunkType* current = chunk(position.chunk_);
+    size_t index = position.index_;
+    assert(index < current->size);
+    current->data()[index].~T();
+    moveElements(current, index, current, index + 1, current->size - index - 1);
+    --current->size;
+    --size_;
+    if (current->size == 0)
+    {
+      ChunkBase* next = current->next;
+      deleteChunk(current);
+      return Iterator(next, 0);
+    }
+    ChunkBase* base = current;
+    if (base->size < N / 2)
+    {
+      if (base->next != end_)
+      {
+        balanceWithNext(base);
+      }
+      else if (base->prev != end_)
+      {
+        base = balanceWithPrev(base, index);
+      }
+    }
+    if (index == base->size)
+    {
+      return Iterator(base->next, 0);
+    }
+    return Iterator(base, index);
+  }
+
+  template< typename T, size_t N >
+  typename UnrolledList< T, N >::Iterator UnrolledList< T, N >::erase(ConstIterator first, ConstIterator last) noexcept
+  {
+    size_t count = std::distance(first, last);
+    Iterator it(first.chunk_, first.index_);
+    for (; count != 0; --count)
+    {
+      it = erase(it);
+    }
+    return it;
+  }
+
+  template< typename T, size_t N >
+  typename UnrolledList< T, N >::Iterator UnrolledList< T, N >::insert(ConstIterator position, const T& data)
+  {
+    return emplace(position, data);
+  }
+
+  template< typename T, size_t N >
+  typename UnrolledList< T, N >::Iterator UnrolledList< T, N >::insert(ConstIterator position, T&& data)
+  {
+    return emplace(position, std::move(data));
+  }
+
+  template< typename T, size_t N >
+  typename UnrolledList< T, N >::Iterator UnrolledList< T, N >::insert(ConstIterator position, size_t n, const T& data)
+  {
+    UnrolledList< T, N > temp(n, data);
+    return spliceChunks(position, temp, temp.cbegin(), temp.cend());
+  }
+
+  template< typename T, size_t N >
+  template< typename InputIterator >
+  typename UnrolledList< T, N >::Iterator UnrolledList< T, N >::insert(ConstIterator pos,
+    InputIterator first, InputIterator last)
+  {
+    UnrolledList< T, N > temp(first, last);
+    return spliceChunks(pos, temp, temp.cbegin(), temp.cend());
+  }
+
+  template< typename T, size_t N >
+  typename UnrolledList< T, N >::Iterator UnrolledList< T, N >::insert(ConstIterator position,
+    std::initializer_list< T > il)
+  {
+    return insert(position, il.begin(), il.end());
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::remove(const T& data) noexcept
+  {
+    for (ConstIterator it = cbegin(); it != cend();)
+    {
+      if (*it == data)
+      {
+        it = erase(it);
+      }
+      else
+      {
+        ++it;
+      }
+    }
+  }
+
+  template< typename T, size_t N >
+  template< typename Predicate >
+  void UnrolledList< T, N >::remove_if(Predicate pred) noexcept
+  {
+    if (!end_)
+    {
+      return;
+    }
+    for (ChunkBase* base = end_->next; base != end_;)
+    {
+      ChunkType* current = chunk(base);
+      base = base->next;
+      T* data = current->data();
+      size_t kept = 0;
+      for (size_t i = 0; i < current->size; ++i)
+      {
+        if (pred(data[i]))
+        {
+          data[i].~T();
+        }
+        else
+        {
+          if (kept != i)
+          {
+            moveElements(current, kept, current, i, 1);
+          }
+          ++kept;
+        }
+      }
+      size_ -= current->size - kept;
+      current->size = kept;
+      if (kept == 0)
+      {
+        deleteChunk(current);
+        continue;
+      }
+      ChunkBase* prev = current->prev;
+      if (prev == end_)
+      {
+        continue;
+      }
+      if (prev->size < N / 2)
+      {
+        balanceWithNext(prev);
+      }
+      else if (kept < N / 2)
+      {
+        size_t index = 0;
+        balanceWithPrev(current, index);
+      }
+    }
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::splice(ConstIterator position, UnrolledList< T, N >& list)
+  {
+    splice(position, list, list.cbegin(), list.cend());
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::splice(ConstIterator position, UnrolledList< T, N >&& list)
+  {
+    splice(position, list);
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::splice(ConstIterator position, UnrolledList< T, N >& list, ConstIterator i)
+  {
+    assert(this != std::addressof(list));
+    emplace(position, std::move(*Iterator(i.chunk_, i.index_)));
+    list.erase(i);
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::splice(ConstIterator position, UnrolledList< T, N >&& list, ConstIterator i)
+  {
+    splice(position, list, i);
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::splice(ConstIterator pos, UnrolledList< T, N >& list,
+    ConstIterator first, ConstIterator last)
+  {
+    spliceChunks(pos, list, first, last);
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::splice(ConstIterator pos, UnrolledList< T, N >&& list,
+    ConstIterator first, ConstIterator last)
+  {
+    spliceChunks(pos, list, first, last);
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::reverse() noexcept
+  {
+    if (size_ < 2)
+    {
+      return;
+    }
+    ChunkBase* base = end_;
+    do
+    {
+      std::swap(base->next, base->prev);
+      if (base != end_)
+      {
+        T* data = chunk(base)->data();
+        std::reverse(data, data + base->size);
+      }
+      base = base->next;
+    }
+    while (base != end_);
+  }
+
+  template< typename T, size_t N >
+  typename UnrolledList< T, N >::ChunkType* UnrolledList< T, N >::chunk(ChunkBase* base) noexcept
+  {
+    return static_cast< ChunkType* >(base);
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::moveElements(ChunkType* to, size_t toIndex,
+    ChunkType* from, size_t fromIndex, size_t count) noexcept
+  {
+    T* dest = to->data() + toIndex;
+    T* src = from->data() + fromIndex;
+    if (dest > src)
+    {
+      for (size_t i = count; i > 0; --i)
+      {
+        new (dest + i - 1) T(std::move(src[i - 1]));
+        src[i - 1].~T();
+      }
+    }
+    else
+    {
+      for (size_t i = 0; i < count; ++i)
+      {
+        new (dest + i) T(std::move(src[i]));
+        src[i].~T();
+      }
+    }
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::makeEnd()
+  {
+    if (!end_)
+    {
+      end_ = new ChunkBase{ 0, nullptr, nullptr };
+      end_->next = end_;
+      end_->prev = end_;
+    }
+  }
+
+  template< typename T, size_t N >
+  typename UnrolledList< T, N >::ChunkType* UnrolledList< T, N >::newChunkBefore(ChunkBase* position)
+  {
+    ChunkType* created = new ChunkType;
+    created->size = 0;
+    created->next = position;
+    created->prev = position->prev;
+    position->prev->next = created;
+    position->prev = created;
+    return created;
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::deleteChunk(ChunkBase* base) noexcept
+  {
+    base->prev->next = base->next;
+    base->next->prev = base->prev;
+    delete chunk(base);
+  }
+
+  template< typename T, size_t N >
+  ChunkBase* UnrolledList< T, N >::splitAt(ChunkBase* base, size_t index)
+  {
+    if (base == end_ || index == 0)
+    {
+      return base;
+    }
+    ChunkType* tail = newChunkBefore(base->next);
+    moveElements(tail, 0, chunk(base), index, base->size - index);
+    tail->size = base->size - index;
+    base->size = index;
+    return tail;
+  }
+
+  template< typename T, size_t N >
+  bool UnrolledList< T, N >::mergeWithNext(ChunkBase* base) noexcept
+  {
+    ChunkBase* next = base->next;
+    if (base == end_ || next == end_ || base->size + next->size > N)
+    {
+      return false;
+    }
+    moveElements(chunk(base), base->size, chunk(next), 0, next->size);
+    base->size += next->size;
+    deleteChunk(next);
+    return true;
+  }
+
+  template< typename T, size_t N >
+  void UnrolledList< T, N >::balanceWithNext(ChunkBase* base) noexcept
+  {
+    if (mergeWithNext(base))
+    {
+      return;
+    }
+    ChunkBase* next = base->next;
+    size_t count = (next->size - base->size) / 2;
+    moveElements(chunk(base), base->size, chunk(next), 0, count);
+    moveElements(chunk(next), 0, chunk(next), count, next->size - count);
+    base->size += count;
+    next->size -= count;
+  }
+
+  template< typename T, size_t N >
+  ChunkBase* UnrolledList< T, N >::balanceWithPrev(ChunkBase* base, size_t& index) noexcept
+  {
+    ChunkBase* prev = base->prev;
+    size_t prevSize = prev->size;
+    if (mergeWithNext(prev))
+    {
+      index += prevSize;
+      return prev;
+    }
+    size_t count = (prev->size - base->size) / 2;
+    moveElements(chunk(base), count, chunk(base), 0, base->size);
+    moveElements(chunk(base), 0, chunk(prev), prev->size - count, count);
+    base->size += count;
+    prev->size -= count;
+    index += count;
+    return base;
+  }
+
+  template< typename T, size_t N >
+  template< typename... Args >
+  typename UnrolledList< T, N >::Iterator UnrolledList< T, N >::emplace(ConstIterator position, Args&&... args)
+  {
+    T value(std::forward< Args >(args)...);
+    makeEnd();
+    ChunkBase* base = position.chunk_ ? position.chunk_ : end_;
+    size_t index = position.index_;
+    if (index == 0 && base->prev != end_ && base->prev->size < N)
+    {
+      base = base->prev;
+      index = base->size;
+    }
+    else if (base == end_ || (index == 0 && base->size == N))
+    {
+      base = newChunkBefore(base);
+    }
+    else if (base->size == N)
+    {
+      ChunkBase* tail = splitAt(base, N / 2);
+      if (index >= N / 2)
+      {
+        base = tail;
+        index -= N / 2;
+      }
+    }
+    ChunkType* current = chunk(base);
+    moveElements(current, index + 1, current, index, current->size - index);
+    new (current->data() + index) T(std::move(value));
+    ++current->size;
+    ++size_;
+    return Iterator(current, index);
+  }
+
+  template< typename T, size_t N >
+  typename UnrolledList< T, N >::Iterator UnrolledList< T, N >::spliceChunks(ConstIterator pos,
+    UnrolledList< T, N >& list, ConstIterator first, ConstIterator last)
+  {
+    assert(this != std::addressof(list));
+    if (first == last)
+    {
+      return Iterator(pos.chunk_, pos.index_);
+    }
+    makeEnd();
+    ChunkBase* rangeEnd = list.splitAt(last.chunk_, last.index_);
+    ChunkBase* rangeFirst = list.splitAt(first.chunk_, first.index_);
+    ChunkBase* before = splitAt(pos.chunk_ ? pos.chunk_ : end_, pos.index_);
+    ChunkBase* rangeLast = rangeEnd->prev;
+    size_t count = 0;
+    for (ChunkBase* base = rangeFirst; base != rangeEnd; base = base->next)
+    {
+      count += base->size;
+    }
+    ChunkBase* listPrev = rangeFirst->prev;
+    listPrev->next = rangeEnd;
+    rangeEnd->prev = listPrev;
+    list.size_ -= count;
+    list.mergeWithNext(listPrev);
+
+    ChunkBase* prev = before->prev;
+    prev->next = rangeFirst;
+    rangeFirst->prev = prev;
+    rangeLast->next = before;
+    before->prev = rangeLast;
+    size_ += count;
+    mergeWithNext(rangeLast);
+    size_t prevSize = prev->size;
+    if (mergeWithNext(prev))
+    {
+      return Iterator(prev, prevSize);
+    }
+    return Iterator(rangeFirst, 0);
+  }
+}
+#endif
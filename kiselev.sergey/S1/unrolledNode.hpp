@@ -0,0 +1,25 @@
+#ifndef UNROLLEDNODE_HPP
+#define UNROLLEDNODE_HPP
+#include <cstddef>
+
+namespace kiselev
+{
+  struct ChunkBase
+  {
+    size_t size;
+    ChunkBase* next;
+    ChunkBase* prev;
+  };
+
+  template< typename T, size_t N >
+  struct Chunk: ChunkBase
+  {
+    alignas(T) unsigned char storage[N * sizeof(T)];
+
+    T* data() noexcept
+    {
+      return reinterpret_cast< T* >(storage);
+    }
+  };
+}
+#endif
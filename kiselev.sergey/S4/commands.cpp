@@ -2,11 +2,65 @@
 #include <stdexcept>
 #include <utility>
 
+kiselev::FreezableData::FreezableData():
+  tree_(),
+  frozen_(),
+  isFrozen_(false)
+{}
+
+kiselev::FreezableData::FreezableData(const FreezableData& other):
+  tree_(),
+  frozen_(other.frozen()),
+  isFrozen_(true)
+{}
+
+kiselev::FreezableData::FreezableData(FreezableData&& other) noexcept:
+  tree_(std::move(other.tree_)),
+  frozen_(std::move(other.frozen_)),
+  isFrozen_(other.isFrozen_)
+{}
+
+kiselev::FreezableData& kiselev::FreezableData::operator=(const FreezableData& other)
+{
+  FreezableData cpy(other);
+  return *this = std::move(cpy);
+}
+
+kiselev::FreezableData& kiselev::FreezableData::operator=(FreezableData&& other) noexcept
+{
+  tree_ = std::move(other.tree_);
+  frozen_ = std::move(other.frozen_);
+  isFrozen_ = other.isFrozen_;
+  return *this;
+}
+
+void kiselev::FreezableData::insert(const data::value& val)
+{
+  if (isFrozen_)
+  {
+    tree_ = data(frozen_.cbegin(), frozen_.cend());
+    frozen_ = frozenData();
+    isFrozen_ = false;
+  }
+  tree_.insert(tree_.cend(), val);
+}
+
+const kiselev::frozenData& kiselev::FreezableData::frozen() const
+{
+  if (!isFrozen_)
+  {
+    frozen_ = frozenData(tree_.cbegin(), tree_.cend());
+    tree_.clear();
+    isFrozen_ = true;
+  }
+  return frozen_;
+}
+
 void kiselev::print(std::ostream& out, std::istream& in, const dataset& dict)
 {
   std::string name;
   in >> name;
-  data tree = dict.at(name);
+  const frozenData& tree = dict.at(name).frozen();
   if (tree.empty())
   {
     out << "<EMPTY>\n";
@@ -26,17 +80,17 @@ void kiselev::complement(std::istream& in, dataset& dict)
   std::string firstName;
   std::string secondName;
   in >> newName >> firstName >> secondName;
-  data newTree;
-  data firstTree = dict.at(firstName);
-  data secondTree = dict.at(secondName);
+  FreezableData newTree;
+  const frozenData& firstTree = dict.at(firstName).frozen();
+  const frozenData& secondTree = dict.at(secondName).frozen();
   for (auto it = firstTree.cbegin(); it != firstTree.cend(); ++it)
   {
-    if (secondTree.find(it->first) == secondTree.end())
+    if (secondTree.find(it->first) == secondTree.cend())
     {
       newTree.insert(*it);
     }
   }
-  dict[newName] = newTree;
+  dict[newName] = std::move(newTree);
 }
 
 void kiselev::intersect(std::istream& in, dataset& dict)
@@ -45,17 +99,17 @@ void kiselev::intersect(std::istream& in, dataset& dict)
   std::string firstName;
   std::string secondName;
   in >> newName >> firstName >> secondName;
-  data newTree;
-  data firstTree = dict.at(firstName);
-  data secondTree = dict.at(secondName);
+  FreezableData newTree;
+  const frozenData& firstTree = dict.at(firstName).frozen();
+  const frozenData& secondTree = dict.at(secondName).frozen();
   for (auto it = firstTree.cbegin(); it != firstTree.cend(); ++it)
   {
-    if (secondTree.find(it->first) != secondTree.end())
+    if (secondTree.find(it->first) != secondTree.cend())
     {
       newTree.insert(*it);
     }
   }
-  dict[newName] = newTree;
+  dict[newName] = std::move(newTree);
 }
 
 void kiselev::unite(std::istream& in, dataset& dict)
@@ -64,14 +118,24 @@ void kiselev::unite(std::istream& in, dataset& dict)
   std::string firstName;
   std::string secondName;
   in >> newName >> firstName >> secondName;
-  data firstTree = dict.at(firstName);
-  data secondTree = dict.at(secondName);
-  data newTree = firstTree;
+  if (firstName == secondName)
+  {
+    const FreezableData& source = dict.at(firstName);
+    dict[newName] = source;
+    return;
+  }
+  const frozenData& firstTree = dict.at(firstName).frozen();
+  const frozenData& secondTree = dict.at(secondName).frozen();
+  FreezableData newTree;
+  for (auto it = firstTree.cbegin(); it != firstTree.cend(); ++it)
+  {
+    newTree.insert(*it);
+  }
   for (auto it = secondTree.cbegin(); it != secondTree.cend(); ++it)
   {
     newTree.insert(*it);
   }
-  dict[newName] = newTree;
+  dict[newName] = std::move(newTree);
 }
 
 
@@ -3,11 +3,28 @@
 #include <iostream>
 #include <string>
 #include "tree.hpp"
+#include "frozenMap.hpp"
 
 namespace kiselev
 {
   using data = RBTree< size_t, std::string >;
-  using dataset = RBTree< std::string, data >;
+  using frozenData = FrozenMap< size_t, std::string >;
+  class FreezableData
+  {
+  public:
+    FreezableData();
+    FreezableData(const FreezableData&);
+    FreezableData(FreezableData&&) noexcept;
+    FreezableData& operator=(const FreezableData&);
+    FreezableData& operator=(FreezableData&&) noexcept;
+    void insert(const data::value&);
+    const frozenData& frozen() const;
+  private:
+    mutable data tree_;
+    mutable frozenData frozen_;
+    mutable bool isFrozen_;
+  };
+  using dataset = RBTree< std::string, FreezableData >;
   void print(std::ostream&, std::istream&, const dataset&);
   void complement(std::istream&, dataset&);
   void intersect(std::istream&, dataset&);
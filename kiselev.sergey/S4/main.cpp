@@ -13,7 +13,7 @@ namespace
     size_t key;
     while (in >> name)
     {
-      kiselev::data tree;
+      kiselev::FreezableData tree;
       if (in.get() == '\n')
       {
         dictionary.insert(std::make_pair(name, tree));
@@ -1,6 +1,7 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/test/unit_test_suite.hpp>
 #include "tree.hpp"
+#include "frozenMap.hpp"
 
 using namespace kiselev;
 
@@ -159,4 +160,149 @@ BOOST_AUTO_TEST_CASE(count_lowerBound_upperBound_equalRange)
   BOOST_CHECK(first == tree.equalRange(3).first);
   BOOST_CHECK(it == tree.equalRange(3).second);
 }
+
+BOOST_AUTO_TEST_CASE(select_rank_countRange)
+{
+  using OrderTree = RBTree< size_t, std::string, std::less< size_t >, SubtreeSize >;
+  OrderTree tree;
+  for (size_t i = 0; i < 100; ++i)
+  {
+    tree.insert({ (i * 37) % 100 * 2, "v" });
+  }
+  BOOST_TEST(tree.size() == 100);
+  BOOST_TEST(tree.select(0)->first == 0);
+  BOOST_TEST(tree.select(42)->first == 84);
+  BOOST_CHECK(tree.select(100) == tree.end());
+  BOOST_TEST(tree.rank(84) == 42);
+  BOOST_TEST(tree.rank(85) == 43);
+  BOOST_TEST(tree.countRange(10, 20) == 6);
+  BOOST_TEST(tree.countRange(11, 19) == 4);
+  BOOST_TEST(tree.countRange(20, 10) == 0);
+  for (size_t i = 0; i < 100; i += 2)
+  {
+    tree.erase(i * 2);
+  }
+  BOOST_TEST(tree.size() == 50);
+  BOOST_TEST(tree.select(0)->first == 2);
+  BOOST_TEST(tree.rank(6) == 1);
+  BOOST_TEST(tree.countRange(0, 198) == 50);
+  const OrderTree& cref = tree;
+  size_t i = 0;
+  for (auto it = cref.cbegin(); it != cref.cend(); ++it, ++i)
+  {
+    BOOST_CHECK(cref.select(i) == it);
+    BOOST_TEST(cref.rank(it->first) == i);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(hinted_insert)
+{
+  using OrderTree = RBTree< size_t, std::string, std::less< size_t >, SubtreeSize >;
+  OrderTree ascending;
+  for (size_t i = 0; i < 1000; ++i)
+  {
+    OrderTree::Iterator it = ascending.insert(ascending.cend(), { i, "a" });
+    BOOST_TEST(it->first == i);
+  }
+  BOOST_TEST(ascending.size() == 1000);
+  BOOST_TEST(ascending.rank(500) == 500);
+  BOOST_TEST(ascending.insert(ascending.cend(), { 10, "b" })->second == "a");
+  RBTree< size_t, std::string > mixed;
+  for (size_t i = 0; i < 1000; ++i)
+  {
+    size_t key = (i * 7919) % 1000;
+    RBTree< size_t, std::string >::ConstIterator hint = mixed.find((i * 31) % 1000);
+    if (i % 3 == 0)
+    {
+      hint = mixed.cbegin();
+    }
+    BOOST_TEST(mixed.insert(hint, { key, "m" })->first == key);
+  }
+  BOOST_TEST(mixed.size() == 1000);
+  size_t expected = 0;
+  for (auto it = mixed.cbegin(); it != mixed.cend(); ++it, ++expected)
+  {
+    BOOST_TEST(it->first == expected);
+  }
+  RBTree< size_t, std::string > copy(mixed);
+  BOOST_TEST(copy.size() == 1000);
+  BOOST_TEST(copy.at(999) == "m");
+}
+
+BOOST_AUTO_TEST_CASE(hinted_insert_after_hint)
+{
+  using OrderTree = RBTree< size_t, std::string, std::less< size_t >, SubtreeSize >;
+  OrderTree tree;
+  for (size_t i = 0; i < 1000; i += 2)
+  {
+    tree.insert(tree.cend(), { i, "e" });
+  }
+  for (size_t i = 1; i < 1000; i += 2)
+  {
+    OrderTree::ConstIterator hint = tree.find(i - 1);
+    BOOST_TEST(tree.insert(hint, { i, "o" })->first == i);
+  }
+  BOOST_TEST(tree.size() == 1000);
+  size_t expected = 0;
+  for (auto it = tree.cbegin(); it != tree.cend(); ++it, ++expected)
+  {
+    BOOST_TEST(it->first == expected);
+    BOOST_TEST(tree.rank(it->first) == expected);
+  }
+  for (size_t i = 999; i >= 500; --i)
+  {
+    OrderTree::ConstIterator last = tree.cend();
+    --last;
+    BOOST_TEST(last->first == i);
+    tree.erase(last);
+  }
+  BOOST_TEST(tree.insert(tree.cend(), { 700, "t" })->first == 700);
+  OrderTree::ConstIterator last = tree.cend();
+  --last;
+  BOOST_TEST(last->first == 700);
+  tree.erase(tree.cbegin(), tree.cend());
+  BOOST_TEST(tree.empty());
+  BOOST_TEST(tree.insert(tree.cend(), { 1, "1" })->first == 1);
+}
+
+BOOST_AUTO_TEST_CASE(frozen_map)
+{
+  FrozenMap< size_t, std::string > empty;
+  BOOST_TEST(empty.empty());
+  BOOST_CHECK(empty.find(0) == empty.cend());
+  RBTree< size_t, std::string > tree;
+  for (size_t i = 0; i < 100; ++i)
+  {
+    tree.insert({ (i * 37) % 100 * 2, std::to_string(i) });
+  }
+  FrozenMap< size_t, std::string > frozen(tree.cbegin(), tree.cend());
+  BOOST_TEST(frozen.size() == 100);
+  auto treeIt = tree.cbegin();
+  for (auto it = frozen.cbegin(); it != frozen.cend(); ++it, ++treeIt)
+  {
+    BOOST_CHECK(*it == *treeIt);
+  }
+  for (size_t i = 0; i < 201; ++i)
+  {
+    auto it = frozen.find(i);
+    if (i % 2 == 0 && i < 200)
+    {
+      BOOST_TEST(it->first == i);
+      BOOST_TEST(frozen.at(i) == tree.at(i));
+    }
+    else
+    {
+      BOOST_CHECK(it == frozen.cend());
+    }
+  }
+  BOOST_CHECK_THROW(frozen.at(1), std::out_of_range);
+  FrozenMap< size_t, std::string > copy(frozen);
+  FrozenMap< size_t, std::string > moved(std::move(frozen));
+  BOOST_TEST(frozen.empty());
+  BOOST_TEST(copy.count(84) == 1);
+  BOOST_TEST(moved.count(85) == 0);
+  BOOST_CHECK(copy.cbegin() == moved.cbegin());
+  copy = FrozenMap< size_t, std::string >();
+  BOOST_TEST(moved.at(84) == tree.at(84));
+}
 BOOST_AUTO_TEST_SUITE_END();
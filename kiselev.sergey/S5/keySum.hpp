@@ -1,5 +1,6 @@
 #ifndef KEYSUM_HPP
 #define KEYSUM_HPP
+#include <ostream>
 #include <string>
 #include <limits>
 #include <stdexcept>
@@ -8,6 +9,12 @@ namespace kiselev
 {
   struct KeySum
   {
+    KeySum() = default;
+    explicit KeySum(std::ostream* sink) noexcept:
+      out(sink),
+      collect(false)
+    {}
+
     void operator()(const std::pair< const int, std::string >& pair)
     {
       const int max = std::numeric_limits< int >::max();
@@ -16,15 +23,56 @@ namespace kiselev
       {
         throw std::logic_error("Overflow");
       }
-      if ((sum < 0 && pair.first < 0) && (sum < min + pair.first))
+      if ((sum < 0 && pair.first < 0) && (sum < min - pair.first))
       {
         throw std::logic_error("Underflow");
       }
       sum += pair.first;
-      str += " " + pair.second;
+      if (out)
+      {
+        *out << ' ' << pair.second;
+      }
+      else if (collect)
+      {
+        str += ' ';
+        str += pair.second;
+      }
     }
     int sum = 0;
     std::string str;
+    std::ostream* out = nullptr;
+    bool collect = true;
   };
+
+  struct PartialKeySum
+  {
+    void operator()(const std::pair< const int, std::string >& pair)
+    {
+      sum += pair.first;
+      str += ' ';
+      str += pair.second;
+    }
+    int total() const
+    {
+      if (sum > std::numeric_limits< int >::max())
+      {
+        throw std::logic_error("Overflow");
+      }
+      if (sum < std::numeric_limits< int >::min())
+      {
+        throw std::logic_error("Underflow");
+      }
+      return static_cast< int >(sum);
+    }
+    long long sum = 0;
+    std::string str;
+  };
+
+  inline PartialKeySum joinKeySums(PartialKeySum lhs, const PartialKeySum& rhs)
+  {
+    lhs.sum += rhs.sum;
+    lhs.str += rhs.str;
+    return lhs;
+  }
 }
 #endif
@@ -2,6 +2,7 @@
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <utility>
 #include "tree.hpp"
@@ -15,7 +16,7 @@ namespace
     std::pair< int, std::string > pair;
     while (input >> pair.first >> pair.second)
     {
-      tree.insert(pair);
+      tree.insert(tree.cend(), pair);
     }
   }
 }
@@ -48,9 +49,11 @@ int main(int argc, char** argv)
     traverse["breadth"] = std::bind(&Tree::traverse_breadth< KeySum >, std::ref(tree), _1);
     try
     {
-      KeySum funct;
-      funct = traverse.at(argv[1])(funct);
-      std::cout << funct.sum << funct.str << "\n";
+      std::function< KeySum(KeySum) >& traversal = traverse.at(argv[1]);
+      KeySum funct = traversal(KeySum(nullptr));
+      std::cout << funct.sum;
+      traversal(KeySum(std::addressof(std::cout)));
+      std::cout << "\n";
     }
     catch (const std::exception& e)
     {
@@ -1,9 +1,13 @@
+#include <limits>
+#include <memory>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <boost/test/tools/interface.hpp>
 #include <boost/test/unit_test.hpp>
 #include <boost/test/unit_test_suite.hpp>
 #include "tree.hpp"
+#include "parallelReduce.hpp"
 #include "keySum.hpp"
 
 using namespace kiselev;
@@ -26,4 +30,125 @@ BOOST_AUTO_TEST_CASE(traverse)
   funBreadth = tree.traverse_breadth(funBreadth);
   iss << funBreadth.sum << funBreadth.str;
   BOOST_TEST(iss.str() == "45 a b c d e");
+  iss.str("");
+  KeySum funSink = tree.traverse_rnl(KeySum(std::addressof(iss)));
+  BOOST_TEST(iss.str() == " c a e b d");
+  BOOST_TEST(funSink.sum == 45);
+  BOOST_TEST(funSink.str.empty());
+  KeySum funSum = tree.traverse_lnr(KeySum(nullptr));
+  BOOST_TEST(funSum.sum == 45);
+  BOOST_TEST(funSum.str.empty());
+}
+
+BOOST_AUTO_TEST_CASE(parallel_reduction)
+{
+  RBTree< int, std::string > tree;
+  for (int i = 1; i <= 500; ++i)
+  {
+    tree.insert({ i, std::to_string(i) });
+    tree.insert({ -i, std::to_string(-i) });
+  }
+  KeySum sequential = tree.traverse_lnr(KeySum());
+  for (size_t threads = 1; threads <= 8; ++threads)
+  {
+    PartialKeySum parallel = parallel_reduce(tree, PartialKeySum(), joinKeySums, threads);
+    BOOST_TEST(parallel.total() == sequential.sum);
+    BOOST_TEST(parallel.str == sequential.str);
+  }
+  const int max = std::numeric_limits< int >::max();
+  tree.insert({ max, "max" });
+  tree.insert({ max - 1, "max" });
+  tree.insert({ std::numeric_limits< int >::min() + 1, "min" });
+  BOOST_TEST(parallel_reduce(tree, PartialKeySum(), joinKeySums, 4).total() == max - 1);
+  tree.insert({ max - 2, "max" });
+  BOOST_CHECK_THROW(parallel_reduce(tree, PartialKeySum(), joinKeySums, 4).total(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(breadth_traversal)
+{
+  RBTree< int, std::string > tree({ { 10, "a" }, { 7, "b" }, { 15, "c" }, { 5, "d" }, { 8, "e" } });
+  RBTree< int, std::string >::ConstBreadthTraversal traversal = tree.breadthCtraversal();
+  std::string order;
+  for (auto it = traversal.begin(); it != traversal.end(); ++it)
+  {
+    order += it->second;
+  }
+  BOOST_TEST(order == "abcde");
+  auto it = traversal.begin();
+  auto copy = it;
+  BOOST_TEST((it++)->second == "a");
+  BOOST_TEST(copy->second == "a");
+  BOOST_TEST(it->second == "b");
+  order.clear();
+  for (; it != traversal.end(); ++it)
+  {
+    order += it->second;
+  }
+  BOOST_TEST(order == "bcde");
+  RBTree< int, std::string > empty;
+  RBTree< int, std::string >::BreadthTraversal emptyTraversal = empty.breadthTraversal();
+  BOOST_CHECK(emptyTraversal.begin() == emptyTraversal.end());
+}
+
+BOOST_AUTO_TEST_CASE(range_sum)
+{
+  using SumTree = RBTree< int, std::string, std::less< int >, SubtreeSum< int > >;
+  SumTree tree;
+  for (int i = -50; i <= 50; ++i)
+  {
+    tree.insert({ i * 3, "v" });
+  }
+  BOOST_TEST(tree.rangeSum(-150, 150) == 0);
+  BOOST_TEST(tree.rangeSum(0, 9) == 18);
+  BOOST_TEST(tree.rangeSum(1, 8) == 9);
+  BOOST_TEST(tree.rangeSum(10, 1) == 0);
+  tree.erase(3);
+  tree.erase(6);
+  BOOST_TEST(tree.rangeSum(0, 9) == 9);
+  const int max = std::numeric_limits< int >::max();
+  tree.insert({ max, "max" });
+  tree.insert({ max - 1, "max" });
+  BOOST_TEST(tree.rangeSum(max, max) == max);
+  BOOST_CHECK_THROW(tree.rangeSum(max - 1, max), std::logic_error);
+  BOOST_TEST(tree.rangeSum(-150, 0) == -3825);
+}
+
+BOOST_AUTO_TEST_CASE(range_sum_order_independent)
+{
+  using SumTree = RBTree< int, std::string, std::less< int >, SubtreeSum< int > >;
+  const int max = std::numeric_limits< int >::max();
+  const int min = std::numeric_limits< int >::min();
+  const int keys[] = { -max, -max + 5, 1, 2, 3, max - 20, max - 10 };
+  SumTree ascending;
+  SumTree shuffled;
+  for (int key: keys)
+  {
+    ascending.insert({ key, "v" });
+  }
+  for (size_t i: { 5, 0, 3, 6, 1, 4, 2 })
+  {
+    shuffled.insert({ keys[i], "v" });
+  }
+  BOOST_TEST(ascending.rangeSum(min, max) == -19);
+  BOOST_TEST(shuffled.rangeSum(min, max) == -19);
+  BOOST_TEST(shuffled.rangeSum(1, max - 20) == max - 14);
+  BOOST_TEST(ascending.rangeSum(-max + 5, 3) == -max + 11);
+  try
+  {
+    shuffled.rangeSum(min, 1);
+    BOOST_ERROR("Expected underflow");
+  }
+  catch (const std::logic_error& e)
+  {
+    BOOST_TEST(std::string(e.what()) == "Underflow");
+  }
+  try
+  {
+    shuffled.rangeSum(2, max);
+    BOOST_ERROR("Expected overflow");
+  }
+  catch (const std::logic_error& e)
+  {
+    BOOST_TEST(std::string(e.what()) == "Overflow");
+  }
 }
@@ -8,67 +8,67 @@
 
 namespace kiselev
 {
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Augment >
   class RBTree;
 
   namespace detail
   {
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
     class BreadthIterator: public std::iterator< std::forward_iterator_tag, std::pair< Key, Value > >
     {
     public:
       using value = std::pair< Key, Value >;
       using reference = std::conditional_t< IsConst, const value&, value& >;
       using pointer = std::conditional_t< IsConst, const value*, value* >;
-      using Node = TreeNode< Key, Value >;
+      using Node = TreeNode< Key, Value, Augment >;
 
       BreadthIterator() noexcept;
       template < bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > = 0 >
-      BreadthIterator(const BreadthIterator< Key, Value, Cmp, OtherIsConst >&);
+      BreadthIterator(const BreadthIterator< Key, Value, Cmp, Augment, OtherIsConst >&);
       template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > = 0 >
-      BreadthIterator< Key, Value, Cmp, IsConst > operator=(const BreadthIterator< Key, Value, Cmp, OtherIsConst >&);
+      BreadthIterator< Key, Value, Cmp, Augment, IsConst > operator=(const BreadthIterator< Key, Value, Cmp, Augment, OtherIsConst >&);
 
-      BreadthIterator< Key, Value, Cmp, IsConst > operator++();
-      BreadthIterator< Key, Value, Cmp, IsConst > operator++(int);
+      BreadthIterator< Key, Value, Cmp, Augment, IsConst > operator++();
+      BreadthIterator< Key, Value, Cmp, Augment, IsConst > operator++(int);
 
 
       reference operator*() const noexcept;
       pointer operator->() const noexcept;
 
-      bool operator==(const BreadthIterator< Key, Value, Cmp, IsConst >&) const noexcept;
-      bool operator!=(const BreadthIterator< Key, Value, Cmp, IsConst >&) const noexcept;
+      bool operator==(const BreadthIterator< Key, Value, Cmp, Augment, IsConst >&) const noexcept;
+      bool operator!=(const BreadthIterator< Key, Value, Cmp, Augment, IsConst >&) const noexcept;
     private:
       Node* node_;
       Queue< Node* > queue_;
       explicit BreadthIterator(Node*) noexcept;
-      friend class BreadthIterator< Key, Value, Cmp, !IsConst >;
-      friend class RBTree< Key, Value, Cmp >;
+      friend class BreadthIterator< Key, Value, Cmp, Augment, !IsConst >;
+      friend class RBTree< Key, Value, Cmp, Augment >;
     };
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
     template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > >
-    BreadthIterator< Key, Value, Cmp, IsConst >::BreadthIterator(const BreadthIterator< Key, Value, Cmp, OtherIsConst >& oth):
+    BreadthIterator< Key, Value, Cmp, Augment, IsConst >::BreadthIterator(const BreadthIterator< Key, Value, Cmp, Augment, OtherIsConst >& oth):
       node_(oth.node_),
       queue_(oth.queue_)
     {}
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    BreadthIterator< Key, Value, Cmp, IsConst >::BreadthIterator() noexcept:
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    BreadthIterator< Key, Value, Cmp, Augment, IsConst >::BreadthIterator() noexcept:
       node_(nullptr),
       queue_()
     {}
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
     template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > >
-    BreadthIterator< Key, Value, Cmp, IsConst > BreadthIterator< Key, Value, Cmp, IsConst >::operator=(
-      const BreadthIterator< Key, Value, Cmp, OtherIsConst >& oth)
+    BreadthIterator< Key, Value, Cmp, Augment, IsConst > BreadthIterator< Key, Value, Cmp, Augment, IsConst >::operator=(
+      const BreadthIterator< Key, Value, Cmp, Augment, OtherIsConst >& oth)
     {
       node_ = oth.node_;
       queue_ = oth.queue_;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    BreadthIterator< Key, Value, Cmp, IsConst >::BreadthIterator(Node* node) noexcept:
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    BreadthIterator< Key, Value, Cmp, Augment, IsConst >::BreadthIterator(Node* node) noexcept:
       node_(node),
       queue_()
     {
@@ -85,8 +85,8 @@ namespace kiselev
       }
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    BreadthIterator< Key, Value, Cmp, IsConst > BreadthIterator< Key, Value, Cmp, IsConst >::operator++()
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    BreadthIterator< Key, Value, Cmp, Augment, IsConst > BreadthIterator< Key, Value, Cmp, Augment, IsConst >::operator++()
     {
       if (queue_.empty())
       {
@@ -106,36 +106,36 @@ namespace kiselev
       return *this;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    BreadthIterator< Key, Value, Cmp, IsConst > BreadthIterator< Key, Value, Cmp, IsConst >::operator++(int)
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    BreadthIterator< Key, Value, Cmp, Augment, IsConst > BreadthIterator< Key, Value, Cmp, Augment, IsConst >::operator++(int)
     {
-      BreadthIterator< Key, Value, Cmp, IsConst > result(*this);
+      BreadthIterator< Key, Value, Cmp, Augment, IsConst > result(*this);
       ++(*this);
       return result;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    typename BreadthIterator< Key, Value, Cmp, IsConst >::reference BreadthIterator< Key, Value, Cmp, IsConst >::operator*() const noexcept
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    typename BreadthIterator< Key, Value, Cmp, Augment, IsConst >::reference BreadthIterator< Key, Value, Cmp, Augment, IsConst >::operator*() const noexcept
     {
       assert(node_ != nullptr);
       return node_->data;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    typename BreadthIterator< Key, Value, Cmp, IsConst >::pointer BreadthIterator< Key, Value, Cmp, IsConst >::operator->() const noexcept
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    typename BreadthIterator< Key, Value, Cmp, Augment, IsConst >::pointer BreadthIterator< Key, Value, Cmp, Augment, IsConst >::operator->() const noexcept
     {
       assert(node_ != nullptr);
       return std::addressof(node_->data);
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    bool BreadthIterator< Key, Value, Cmp, IsConst >::operator==(const BreadthIterator<Key, Value, Cmp, IsConst>& oth) const noexcept
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    bool BreadthIterator< Key, Value, Cmp, Augment, IsConst >::operator==(const BreadthIterator<Key, Value, Cmp, Augment, IsConst>& oth) const noexcept
     {
       return node_ == oth.node_;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    bool BreadthIterator< Key, Value, Cmp, IsConst >::operator!=(const BreadthIterator< Key, Value, Cmp, IsConst >& oth) const noexcept
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    bool BreadthIterator< Key, Value, Cmp, Augment, IsConst >::operator!=(const BreadthIterator< Key, Value, Cmp, Augment, IsConst >& oth) const noexcept
     {
       return !(*this == oth);
     }
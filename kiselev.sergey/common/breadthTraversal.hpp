@@ -0,0 +1,214 @@
+#ifndef BREADTHTRAVERSAL_HPP
+#define BREADTHTRAVERSAL_HPP
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include "treeNode.hpp"
+
+namespace kiselev
+{
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  class RBTree;
+
+  namespace detail
+  {
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    class BreadthTraversal;
+
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    class BreadthHandle: public std::iterator< std::input_iterator_tag, std::pair< Key, Value > >
+    {
+    public:
+      using value = std::pair< Key, Value >;
+      using reference = std::conditional_t< IsConst, const value&, value& >;
+      using pointer = std::conditional_t< IsConst, const value*, value* >;
+      using Traversal = BreadthTraversal< Key, Value, Cmp, Augment, IsConst >;
+
+      BreadthHandle() noexcept;
+
+      BreadthHandle< Key, Value, Cmp, Augment, IsConst >& operator++() noexcept;
+      BreadthHandle< Key, Value, Cmp, Augment, IsConst > operator++(int) noexcept;
+
+      reference operator*() const noexcept;
+      pointer operator->() const noexcept;
+
+      bool operator==(const BreadthHandle< Key, Value, Cmp, Augment, IsConst >&) const noexcept;
+      bool operator!=(const BreadthHandle< Key, Value, Cmp, Augment, IsConst >&) const noexcept;
+    private:
+      using Node = TreeNode< Key, Value, Augment >;
+      Traversal* traversal_;
+      Node* node_;
+      explicit BreadthHandle(Traversal*) noexcept;
+      friend class BreadthTraversal< Key, Value, Cmp, Augment, IsConst >;
+    };
+
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    class BreadthTraversal
+    {
+    public:
+      using Handle = BreadthHandle< Key, Value, Cmp, Augment, IsConst >;
+      using Node = TreeNode< Key, Value, Augment >;
+
+      BreadthTraversal(const BreadthTraversal< Key, Value, Cmp, Augment, IsConst >&) = delete;
+      BreadthTraversal(BreadthTraversal< Key, Value, Cmp, Augment, IsConst >&&) noexcept;
+      ~BreadthTraversal();
+      BreadthTraversal< Key, Value, Cmp, Augment, IsConst >& operator=(
+        const BreadthTraversal< Key, Value, Cmp, Augment, IsConst >&) = delete;
+
+      Handle begin() noexcept;
+      Handle end() noexcept;
+
+    private:
+      Node* root_;
+      Node* node_;
+      Node** frontier_;
+      size_t capacity_;
+      size_t head_;
+      size_t count_;
+
+      BreadthTraversal(Node* root, size_t size);
+      void push(Node*) noexcept;
+      void next() noexcept;
+      friend class BreadthHandle< Key, Value, Cmp, Augment, IsConst >;
+      friend class RBTree< Key, Value, Cmp, Augment >;
+    };
+
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    BreadthHandle< Key, Value, Cmp, Augment, IsConst >::BreadthHandle() noexcept:
+      traversal_(nullptr),
+      node_(nullptr)
+    {}
+
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    BreadthHandle< Key, Value, Cmp, Augment, IsConst >::BreadthHandle(Traversal* traversal) noexcept:
+      traversal_(traversal),
+      node_(traversal->node_)
+    {}
+
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    BreadthHandle< Key, Value, Cmp, Augment, IsConst >& BreadthHandle< Key, Value, Cmp, Augment, IsConst >::operator++() noexcept
+    {
+      assert(node_ != nullptr);
+      traversal_->next();
+      node_ = traversal_->node_;
+      return *this;
+    }
+
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    BreadthHandle< Key, Value, Cmp, Augment, IsConst > BreadthHandle< Key, Value, Cmp, Augment, IsConst >::operator++(int) noexcept
+    {
+      BreadthHandle< Key, Value, Cmp, Augment, IsConst > result(*this);
+      ++(*this);
+      return result;
+    }
+
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    typename BreadthHandle< Key, Value, Cmp, Augment, IsConst >::reference
+      BreadthHandle< Key, Value, Cmp, Augment, IsConst >::operator*() const noexcept
+    {
+      assert(node_ != nullptr);
+      return node_->data;
+    }
+
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    typename BreadthHandle< Key, Value, Cmp, Augment, IsConst >::pointer
+      BreadthHandle< Key, Value, Cmp, Augment, IsConst >::operator->() const noexcept
+    {
+      assert(node_ != nullptr);
+      return std::addressof(node_->data);
+    }
+
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    bool BreadthHandle< Key, Value, Cmp, Augment, IsConst >::operator==(
+      const BreadthHandle< Key, Value, Cmp, Augment, IsConst >& oth) const noexcept
+    {
+      return node_ == oth.node_;
+    }
+
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    bool BreadthHandle< Key, Value, Cmp, Augment, IsConst >::operator!=(
+      const BreadthHandle< Key, Value, Cmp, Augment, IsConst >& oth) const noexcept
+    {
+      return !(*this == oth);
+    }
+
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    BreadthTraversal< Key, Value, Cmp, Augment, IsConst >::BreadthTraversal(Node* root, size_t size):
+      root_(root),
+      node_(nullptr),
+      frontier_(root ? new Node*[size / 2 + 1] : nullptr),
+      capacity_(root ? size / 2 + 1 : 0),
+      head_(0),
+      count_(0)
+    {}
+
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    BreadthTraversal< Key, Value, Cmp, Augment, IsConst >::BreadthTraversal(
+      BreadthTraversal< Key, Value, Cmp, Augment, IsConst >&& oth) noexcept:
+      root_(std::exchange(oth.root_, nullptr)),
+      node_(std::exchange(oth.node_, nullptr)),
+      frontier_(std::exchange(oth.frontier_, nullptr)),
+      capacity_(std::exchange(oth.capacity_, 0)),
+      head_(std::exchange(oth.head_, 0)),
+      count_(std::exchange(oth.count_, 0))
+    {}
+
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    BreadthTraversal< Key, Value, Cmp, Augment, IsConst >::~BreadthTraversal()
+    {
+      delete[] frontier_;
+    }
+
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    typename BreadthTraversal< Key, Value, Cmp, Augment, IsConst >::Handle BreadthTraversal< Key, Value, Cmp, Augment, IsConst >::begin() noexcept
+    {
+      head_ = 0;
+      count_ = 0;
+      node_ = nullptr;
+      if (root_)
+      {
+        push(root_);
+        next();
+      }
+      return Handle(this);
+    }
+
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    typename BreadthTraversal< Key, Value, Cmp, Augment, IsConst >::Handle BreadthTraversal< Key, Value, Cmp, Augment, IsConst >::end() noexcept
+    {
+      return Handle();
+    }
+
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    void BreadthTraversal< Key, Value, Cmp, Augment, IsConst >::push(Node* node) noexcept
+    {
+      assert(count_ < capacity_);
+      frontier_[(head_ + count_) % capacity_] = node;
+      ++count_;
+    }
+
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    void BreadthTraversal< Key, Value, Cmp, Augment, IsConst >::next() noexcept
+    {
+      if (count_ == 0)
+      {
+        node_ = nullptr;
+        return;
+      }
+      node_ = frontier_[head_];
+      head_ = (head_ + 1) % capacity_;
+      --count_;
+      if (node_->left)
+      {
+        push(node_->left);
+      }
+      if (node_->right)
+      {
+        push(node_->right);
+      }
+    }
+  }
+}
+#endif
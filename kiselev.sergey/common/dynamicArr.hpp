@@ -208,7 +208,7 @@ namespace kiselev
   template< typename T >
   void DynamicArr< T >::push(const T& data) noexcept
   {
-    if (size_ >= capacity_)
+    if (begin_ + size_ >= capacity_)
     {
       reallocate();
     }
@@ -219,7 +219,7 @@ namespace kiselev
   template< typename T >
   void DynamicArr< T >::push(T&& data) noexcept
   {
-    if (size_ >= capacity_)
+    if (begin_ + size_ >= capacity_)
     {
       reallocate();
     }
@@ -0,0 +1,250 @@
+#ifndef FROZENMAP_HPP
+#define FROZENMAP_HPP
+#include <functional>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace kiselev
+{
+  template< typename Key, typename Value, typename Cmp = std::less< Key > >
+  class FrozenMap
+  {
+  public:
+    using value = std::pair< Key, Value >;
+    using ConstIterator = const value*;
+
+    FrozenMap() noexcept;
+    FrozenMap(const FrozenMap< Key, Value, Cmp >&);
+    FrozenMap(FrozenMap< Key, Value, Cmp >&&) noexcept;
+    template< typename ForwardIt >
+    FrozenMap(ForwardIt first, ForwardIt last);
+    ~FrozenMap();
+
+    FrozenMap< Key, Value, Cmp >& operator=(const FrozenMap< Key, Value, Cmp >&);
+    FrozenMap< Key, Value, Cmp >& operator=(FrozenMap< Key, Value, Cmp >&&) noexcept;
+
+    const Value& at(const Key&) const;
+
+    size_t size() const noexcept;
+    bool empty() const noexcept;
+
+    ConstIterator cbegin() const noexcept;
+    ConstIterator cend() const noexcept;
+
+    ConstIterator find(const Key&) const;
+    size_t count(const Key&) const;
+
+    void swap(FrozenMap< Key, Value, Cmp >&) noexcept;
+
+  private:
+    value* values_;
+    Key* keys_;
+    size_t* positions_;
+    size_t* refs_;
+    size_t size_;
+    Cmp cmp_;
+
+    void clear() noexcept;
+    size_t layout(size_t, size_t);
+  };
+
+  template< typename Key, typename Value, typename Cmp >
+  FrozenMap< Key, Value, Cmp >::FrozenMap() noexcept:
+    values_(nullptr),
+    keys_(nullptr),
+    positions_(nullptr),
+    refs_(nullptr),
+    size_(0),
+    cmp_()
+  {}
+
+  template< typename Key, typename Value, typename Cmp >
+  FrozenMap< Key, Value, Cmp >::FrozenMap(const FrozenMap< Key, Value, Cmp >& map):
+    values_(map.values_),
+    keys_(map.keys_),
+    positions_(map.positions_),
+    refs_(map.refs_),
+    size_(map.size_),
+    cmp_(map.cmp_)
+  {
+    if (refs_)
+    {
+      ++*refs_;
+    }
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  FrozenMap< Key, Value, Cmp >::FrozenMap(FrozenMap< Key, Value, Cmp >&& map) noexcept:
+    values_(std::exchange(map.values_, nullptr)),
+    keys_(std::exchange(map.keys_, nullptr)),
+    positions_(std::exchange(map.positions_, nullptr)),
+    refs_(std::exchange(map.refs_, nullptr)),
+    size_(std::exchange(map.size_, 0)),
+    cmp_(std::move(map.cmp_))
+  {}
+
+  template< typename Key, typename Value, typename Cmp >
+  template< typename ForwardIt >
+  FrozenMap< Key, Value, Cmp >::FrozenMap(ForwardIt first, ForwardIt last):
+    FrozenMap()
+  {
+    const size_t count = std::distance(first, last);
+    if (count == 0)
+    {
+      return;
+    }
+    try
+    {
+      values_ = static_cast< value* >(::operator new(count * sizeof(value)));
+      for (; first != last; ++first, ++size_)
+      {
+        new (values_ + size_) value(*first);
+      }
+      keys_ = new Key[size_ + 1];
+      positions_ = new size_t[size_ + 1];
+      refs_ = new size_t(1);
+      layout(0, 1);
+    }
+    catch (...)
+    {
+      clear();
+      throw;
+    }
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  FrozenMap< Key, Value, Cmp >::~FrozenMap()
+  {
+    clear();
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  FrozenMap< Key, Value, Cmp >& FrozenMap< Key, Value, Cmp >::operator=(const FrozenMap< Key, Value, Cmp >& map)
+  {
+    FrozenMap< Key, Value, Cmp > cpy(map);
+    swap(cpy);
+    return *this;
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  FrozenMap< Key, Value, Cmp >& FrozenMap< Key, Value, Cmp >::operator=(FrozenMap< Key, Value, Cmp >&& map) noexcept
+  {
+    FrozenMap< Key, Value, Cmp > temp(std::move(map));
+    swap(temp);
+    return *this;
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  const Value& FrozenMap< Key, Value, Cmp >::at(const Key& key) const
+  {
+    ConstIterator it = find(key);
+    if (it == cend())
+    {
+      throw std::out_of_range("There is no such key");
+    }
+    return it->second;
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  size_t FrozenMap< Key, Value, Cmp >::size() const noexcept
+  {
+    return size_;
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  bool FrozenMap< Key, Value, Cmp >::empty() const noexcept
+  {
+    return size_ == 0;
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  typename FrozenMap< Key, Value, Cmp >::ConstIterator FrozenMap< Key, Value, Cmp >::cbegin() const noexcept
+  {
+    return values_;
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  typename FrozenMap< Key, Value, Cmp >::ConstIterator FrozenMap< Key, Value, Cmp >::cend() const noexcept
+  {
+    return values_ + size_;
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  typename FrozenMap< Key, Value, Cmp >::ConstIterator FrozenMap< Key, Value, Cmp >::find(const Key& key) const
+  {
+    constexpr size_t lineKeys = sizeof(Key) < 64 ? 64 / sizeof(Key) : 1;
+    size_t node = 1;
+    while (node <= size_)
+    {
+      if (node * lineKeys <= size_)
+      {
+        __builtin_prefetch(keys_ + node * lineKeys);
+      }
+      node = 2 * node + cmp_(keys_[node], key);
+    }
+    while (node & 1)
+    {
+      node >>= 1;
+    }
+    node >>= 1;
+    if (node == 0 || cmp_(key, keys_[node]))
+    {
+      return cend();
+    }
+    return values_ + positions_[node];
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  size_t FrozenMap< Key, Value, Cmp >::count(const Key& key) const
+  {
+    return find(key) != cend();
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  void FrozenMap< Key, Value, Cmp >::swap(FrozenMap< Key, Value, Cmp >& map) noexcept
+  {
+    std::swap(values_, map.values_);
+    std::swap(keys_, map.keys_);
+    std::swap(positions_, map.positions_);
+    std::swap(refs_, map.refs_);
+    std::swap(size_, map.size_);
+    std::swap(cmp_, map.cmp_);
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  void FrozenMap< Key, Value, Cmp >::clear() noexcept
+  {
+    if (!refs_ || --*refs_ == 0)
+    {
+      for (size_t i = 0; i < size_; ++i)
+      {
+        values_[i].~value();
+      }
+      ::operator delete(values_);
+      delete[] keys_;
+      delete[] positions_;
+      delete refs_;
+    }
+    values_ = nullptr;
+    keys_ = nullptr;
+    positions_ = nullptr;
+    refs_ = nullptr;
+    size_ = 0;
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  size_t FrozenMap< Key, Value, Cmp >::layout(size_t sorted, size_t node)
+  {
+    if (node <= size_)
+    {
+      sorted = layout(sorted, 2 * node);
+      keys_[node] = values_[sorted].first;
+      positions_[node] = sorted++;
+      sorted = layout(sorted, 2 * node + 1);
+    }
+    return sorted;
+  }
+}
+#endif
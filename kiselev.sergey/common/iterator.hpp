@@ -6,25 +6,25 @@
 
 namespace kiselev
 {
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Augment >
   class RBTree;
 
   namespace detail
   {
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
     class Iterator: public std::iterator< std::bidirectional_iterator_tag, std::pair< Key, Value > >
     {
     public:
       using value = std::pair< Key, Value >;
       using reference = std::conditional_t< IsConst, const value&, value& >;
       using pointer = std::conditional_t< IsConst, const value*, value* >;
-      using iterator = Iterator< Key, Value, Cmp, IsConst >;
+      using iterator = Iterator< Key, Value, Cmp, Augment, IsConst >;
 
       Iterator();
       template < bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > = 0 >
-      Iterator(const Iterator< Key, Value, Cmp, OtherIsConst >&) noexcept;
+      Iterator(const Iterator< Key, Value, Cmp, Augment, OtherIsConst >&) noexcept;
       template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > = 0 >
-      iterator& operator=(const Iterator< Key, Value, Cmp, OtherIsConst >&) noexcept;
+      iterator& operator=(const Iterator< Key, Value, Cmp, Augment, OtherIsConst >&) noexcept;
 
       iterator& operator++() noexcept;
       iterator operator++(int) noexcept;
@@ -38,47 +38,47 @@ namespace kiselev
       bool operator==(const iterator&) const noexcept;
       bool operator!=(const iterator&) const noexcept;
     private:
-      TreeNode< Key, Value >* node_;
+      TreeNode< Key, Value, Augment >* node_;
       bool isEnd_;
-      Iterator(TreeNode< Key, Value >*, bool);
-      friend class Iterator< Key, Value, Cmp, !IsConst >;
-      friend class RBTree< Key, Value, Cmp >;
+      Iterator(TreeNode< Key, Value, Augment >*, bool);
+      friend class Iterator< Key, Value, Cmp, Augment, !IsConst >;
+      friend class RBTree< Key, Value, Cmp, Augment >;
     };
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    Iterator< Key, Value, Cmp, IsConst >::Iterator():
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    Iterator< Key, Value, Cmp, Augment, IsConst >::Iterator():
       node_(nullptr),
       isEnd_(false)
     {}
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
     template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > >
-    Iterator< Key, Value, Cmp, IsConst >::Iterator(const Iterator< Key, Value, Cmp, OtherIsConst >& other) noexcept:
+    Iterator< Key, Value, Cmp, Augment, IsConst >::Iterator(const Iterator< Key, Value, Cmp, Augment, OtherIsConst >& other) noexcept:
       node_(other.node_),
       isEnd_(other.isEnd_)
     {}
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    Iterator< Key, Value, Cmp, IsConst >::Iterator(TreeNode< Key, Value >* node, bool isEnd):
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    Iterator< Key, Value, Cmp, Augment, IsConst >::Iterator(TreeNode< Key, Value, Augment >* node, bool isEnd):
       node_(node),
       isEnd_(isEnd)
     {}
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
     template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > >
-    Iterator< Key, Value, Cmp, IsConst >& Iterator< Key, Value, Cmp, IsConst >::operator=(
-      const Iterator< Key, Value, Cmp, OtherIsConst >& other) noexcept
+    Iterator< Key, Value, Cmp, Augment, IsConst >& Iterator< Key, Value, Cmp, Augment, IsConst >::operator=(
+      const Iterator< Key, Value, Cmp, Augment, OtherIsConst >& other) noexcept
     {
       node_ = other.node_;
       isEnd_ = other.isEnd_;
       return *this;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    Iterator< Key, Value, Cmp, IsConst >& Iterator< Key, Value, Cmp, IsConst >::operator++() noexcept
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    Iterator< Key, Value, Cmp, Augment, IsConst >& Iterator< Key, Value, Cmp, Augment, IsConst >::operator++() noexcept
     {
       assert(node_ != nullptr);
-      TreeNode< Key, Value >* temp = node_;
+      TreeNode< Key, Value, Augment >* temp = node_;
       if (node_->right)
       {
         node_ = node_->right;
@@ -103,8 +103,8 @@ namespace kiselev
       return *this;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    Iterator< Key, Value, Cmp, IsConst > Iterator< Key, Value, Cmp, IsConst >::operator++(int) noexcept
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    Iterator< Key, Value, Cmp, Augment, IsConst > Iterator< Key, Value, Cmp, Augment, IsConst >::operator++(int) noexcept
     {
       assert(node_ != nullptr);
       iterator result(*this);
@@ -112,8 +112,8 @@ namespace kiselev
       return result;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    Iterator< Key, Value, Cmp, IsConst >& Iterator< Key, Value, Cmp, IsConst >::operator--() noexcept
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    Iterator< Key, Value, Cmp, Augment, IsConst >& Iterator< Key, Value, Cmp, Augment, IsConst >::operator--() noexcept
     {
       assert(node_ != nullptr);
       if (isEnd_)
@@ -129,7 +129,7 @@ namespace kiselev
           {
             node_ = node_->right;
           }
-          return iterator(node_);
+          return *this;
         }
         while (node_->parent && node_ == node_->parent->left)
         {
@@ -140,36 +140,36 @@ namespace kiselev
       return *this;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    Iterator< Key, Value, Cmp, IsConst > Iterator< Key, Value, Cmp, IsConst >::operator--(int) noexcept
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    Iterator< Key, Value, Cmp, Augment, IsConst > Iterator< Key, Value, Cmp, Augment, IsConst >::operator--(int) noexcept
     {
       iterator result(*this);
       --(*this);
       return result;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    typename Iterator< Key, Value, Cmp, IsConst >::reference Iterator< Key, Value, Cmp, IsConst >::operator*() const noexcept
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    typename Iterator< Key, Value, Cmp, Augment, IsConst >::reference Iterator< Key, Value, Cmp, Augment, IsConst >::operator*() const noexcept
     {
       assert(node_ != nullptr);
       return node_->data;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    typename Iterator< Key, Value, Cmp, IsConst >::pointer Iterator< Key, Value, Cmp, IsConst >::operator->() const noexcept
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    typename Iterator< Key, Value, Cmp, Augment, IsConst >::pointer Iterator< Key, Value, Cmp, Augment, IsConst >::operator->() const noexcept
     {
       assert(node_ != nullptr);
       return std::addressof(node_->data);
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    bool Iterator< Key, Value, Cmp, IsConst >::operator==(const iterator& other) const noexcept
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    bool Iterator< Key, Value, Cmp, Augment, IsConst >::operator==(const iterator& other) const noexcept
     {
       return node_ == other.node_ && isEnd_ == other.isEnd_;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    bool Iterator< Key, Value, Cmp, IsConst >::operator!=(const iterator& other) const noexcept
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    bool Iterator< Key, Value, Cmp, Augment, IsConst >::operator!=(const iterator& other) const noexcept
     {
       return !(*this == other);
     }
@@ -9,73 +9,73 @@
 #include "treeNode.hpp"
 namespace kiselev
 {
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Augment >
   class RBTree;
 
   namespace detail
   {
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
     class LnrIterator: public std::iterator< std::forward_iterator_tag, std::pair< Key, Value > >
     {
     public:
       using value = std::pair< Key, Value >;
       using reference = std::conditional_t< IsConst, const value&, value& >;
       using pointer = std::conditional_t< IsConst, const value*, value* >;
-      using Node = TreeNode< Key, Value >;
+      using Node = TreeNode< Key, Value, Augment >;
 
       LnrIterator() noexcept;
       template < bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > = 0 >
-      LnrIterator(const LnrIterator< Key, Value, Cmp, OtherIsConst >&);
+      LnrIterator(const LnrIterator< Key, Value, Cmp, Augment, OtherIsConst >&);
       template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > = 0 >
-      LnrIterator< Key, Value, Cmp, IsConst > operator=(const LnrIterator< Key, Value, Cmp, OtherIsConst >&);
+      LnrIterator< Key, Value, Cmp, Augment, IsConst > operator=(const LnrIterator< Key, Value, Cmp, Augment, OtherIsConst >&);
 
-      LnrIterator< Key, Value, Cmp, IsConst > operator++();
-      LnrIterator< Key, Value, Cmp, IsConst > operator++(int);
+      LnrIterator< Key, Value, Cmp, Augment, IsConst > operator++();
+      LnrIterator< Key, Value, Cmp, Augment, IsConst > operator++(int);
 
 
       reference operator*() const noexcept;
       pointer operator->() const noexcept;
 
-      bool operator==(const LnrIterator< Key, Value, Cmp, IsConst >&) const noexcept;
-      bool operator!=(const LnrIterator< Key, Value, Cmp, IsConst >&) const noexcept;
+      bool operator==(const LnrIterator< Key, Value, Cmp, Augment, IsConst >&) const noexcept;
+      bool operator!=(const LnrIterator< Key, Value, Cmp, Augment, IsConst >&) const noexcept;
     private:
       Node* node_;
       Stack< Node* > stack_;
       explicit LnrIterator(Node*) noexcept;
-      friend class LnrIterator< Key, Value, Cmp, !IsConst >;
-      friend class RBTree< Key, Value, Cmp >;
+      friend class LnrIterator< Key, Value, Cmp, Augment, !IsConst >;
+      friend class RBTree< Key, Value, Cmp, Augment >;
     };
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
     template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > >
-    LnrIterator< Key, Value, Cmp, IsConst >::LnrIterator(const LnrIterator< Key, Value, Cmp, OtherIsConst >& oth):
+    LnrIterator< Key, Value, Cmp, Augment, IsConst >::LnrIterator(const LnrIterator< Key, Value, Cmp, Augment, OtherIsConst >& oth):
       node_(oth.node_),
       stack_(oth.stack_)
     {}
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    LnrIterator< Key, Value, Cmp, IsConst >::LnrIterator() noexcept:
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    LnrIterator< Key, Value, Cmp, Augment, IsConst >::LnrIterator() noexcept:
       node_(nullptr),
       stack_()
     {}
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
     template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > >
-    LnrIterator< Key, Value, Cmp, IsConst > LnrIterator< Key, Value, Cmp, IsConst >::operator=(
-      const LnrIterator< Key, Value, Cmp, OtherIsConst >& oth)
+    LnrIterator< Key, Value, Cmp, Augment, IsConst > LnrIterator< Key, Value, Cmp, Augment, IsConst >::operator=(
+      const LnrIterator< Key, Value, Cmp, Augment, OtherIsConst >& oth)
     {
       node_ = oth.node_;
       stack_ = oth.stack_;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    LnrIterator< Key, Value, Cmp, IsConst >::LnrIterator(Node* node) noexcept:
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    LnrIterator< Key, Value, Cmp, Augment, IsConst >::LnrIterator(Node* node) noexcept:
       node_(node),
       stack_()
     {}
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    LnrIterator< Key, Value, Cmp, IsConst > LnrIterator< Key, Value, Cmp, IsConst >::operator++()
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    LnrIterator< Key, Value, Cmp, Augment, IsConst > LnrIterator< Key, Value, Cmp, Augment, IsConst >::operator++()
     {
       if (!node_)
       {
@@ -93,7 +93,7 @@ namespace kiselev
       }
       else
       {
-        if (!stack_.empty() && stack_.top()->right == node_)
+        while (!stack_.empty() && stack_.top()->right == node_)
         {
           node_ = stack_.top();
           stack_.pop();
@@ -111,36 +111,36 @@ namespace kiselev
       return *this;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    LnrIterator< Key, Value, Cmp, IsConst > LnrIterator< Key, Value, Cmp, IsConst >::operator++(int)
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    LnrIterator< Key, Value, Cmp, Augment, IsConst > LnrIterator< Key, Value, Cmp, Augment, IsConst >::operator++(int)
     {
-      LnrIterator< Key, Value, Cmp, IsConst > result(*this);
+      LnrIterator< Key, Value, Cmp, Augment, IsConst > result(*this);
       ++(*this);
       return result;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    typename LnrIterator< Key, Value, Cmp, IsConst >::reference LnrIterator< Key, Value, Cmp, IsConst >::operator*() const noexcept
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    typename LnrIterator< Key, Value, Cmp, Augment, IsConst >::reference LnrIterator< Key, Value, Cmp, Augment, IsConst >::operator*() const noexcept
     {
       assert(node_ != nullptr);
       return node_->data;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    typename LnrIterator< Key, Value, Cmp, IsConst >::pointer LnrIterator< Key, Value, Cmp, IsConst >::operator->() const noexcept
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    typename LnrIterator< Key, Value, Cmp, Augment, IsConst >::pointer LnrIterator< Key, Value, Cmp, Augment, IsConst >::operator->() const noexcept
     {
       assert(node_ != nullptr);
       return std::addressof(node_->data);
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    bool LnrIterator< Key, Value, Cmp, IsConst >::operator==(const LnrIterator<Key, Value, Cmp, IsConst>& oth) const noexcept
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    bool LnrIterator< Key, Value, Cmp, Augment, IsConst >::operator==(const LnrIterator<Key, Value, Cmp, Augment, IsConst>& oth) const noexcept
     {
       return node_ == oth.node_;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    bool LnrIterator< Key, Value, Cmp, IsConst >::operator!=(const LnrIterator<Key, Value, Cmp, IsConst>& oth) const noexcept
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    bool LnrIterator< Key, Value, Cmp, Augment, IsConst >::operator!=(const LnrIterator<Key, Value, Cmp, Augment, IsConst>& oth) const noexcept
     {
       return !(*this == oth);
     }
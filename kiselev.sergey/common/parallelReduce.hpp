@@ -0,0 +1,189 @@
+#ifndef PARALLELREDUCE_HPP
+#define PARALLELREDUCE_HPP
+#include <atomic>
+#include <exception>
+#include <new>
+#include <thread>
+#include <utility>
+#include "tree.hpp"
+
+namespace kiselev
+{
+  namespace detail
+  {
+    template< typename Node >
+    struct ReducePart
+    {
+      const Node* node;
+      bool whole;
+    };
+
+    template< typename F >
+    void destroyResults(F* results, std::exception_ptr* errors, size_t count) noexcept
+    {
+      for (size_t i = 0; i < count; ++i)
+      {
+        if (!errors[i])
+        {
+          results[i].~F();
+        }
+      }
+      ::operator delete(results);
+      delete[] errors;
+    }
+
+    template< typename Node >
+    void splitParts(const Node* node, size_t depth, ReducePart< Node >* parts, size_t& count) noexcept
+    {
+      if (!node)
+      {
+        return;
+      }
+      if (depth == 0)
+      {
+        parts[count++] = { node, true };
+        return;
+      }
+      splitParts(node->left, depth - 1, parts, count);
+      parts[count++] = { node, false };
+      splitParts(node->right, depth - 1, parts, count);
+    }
+
+    template< typename Node, typename F >
+    void traverseSubtree(const Node* root, F& f)
+    {
+      const Node* node = root;
+      while (node->left)
+      {
+        node = node->left;
+      }
+      while (node)
+      {
+        f(node->data);
+        if (node->right)
+        {
+          node = node->right;
+          while (node->left)
+          {
+            node = node->left;
+          }
+          continue;
+        }
+        while (node != root && node->parent->right == node)
+        {
+          node = node->parent;
+        }
+        node = (node == root) ? nullptr : node->parent;
+      }
+    }
+  }
+
+  template< typename Key, typename Value, typename Cmp, typename Augment, typename F, typename Combine >
+  F parallel_reduce(const RBTree< Key, Value, Cmp, Augment >& tree, F f, Combine combine, size_t threads)
+  {
+    using Node = TreeNode< Key, Value, Augment >;
+    using detail::ReducePart;
+    if (threads < 2 || tree.size_ < 2 * threads)
+    {
+      if (tree.root_)
+      {
+        detail::traverseSubtree(tree.root_, f);
+      }
+      return f;
+    }
+    size_t depth = 0;
+    size_t width = 1;
+    while (width < 4 * threads)
+    {
+      width *= 2;
+      ++depth;
+    }
+    ReducePart< Node >* parts = new ReducePart< Node >[2 * width - 1];
+    std::exception_ptr* errors = nullptr;
+    F* results = nullptr;
+    std::thread* workers = nullptr;
+    size_t count = 0;
+    size_t started = 0;
+    try
+    {
+      detail::splitParts(tree.root_, depth, parts, count);
+      errors = new std::exception_ptr[count];
+      results = static_cast< F* >(::operator new(count * sizeof(F)));
+      workers = new std::thread[threads - 1];
+    }
+    catch (...)
+    {
+      ::operator delete(results);
+      delete[] errors;
+      delete[] parts;
+      throw;
+    }
+    std::atomic< size_t > next(0);
+    auto work = [&]()
+    {
+      for (size_t i = next++; i < count; i = next++)
+      {
+        try
+        {
+          F part(f);
+          if (parts[i].whole)
+          {
+            detail::traverseSubtree(parts[i].node, part);
+          }
+          else
+          {
+            part(parts[i].node->data);
+          }
+          new (results + i) F(std::move(part));
+        }
+        catch (...)
+        {
+          errors[i] = std::current_exception();
+        }
+      }
+    };
+    for (; started < threads - 1; ++started)
+    {
+      try
+      {
+        workers[started] = std::thread(work);
+      }
+      catch (...)
+      {
+        break;
+      }
+    }
+    work();
+    for (size_t i = 0; i < started; ++i)
+    {
+      workers[i].join();
+    }
+    delete[] workers;
+    delete[] parts;
+    std::exception_ptr error = nullptr;
+    for (size_t i = 0; i < count && !error; ++i)
+    {
+      error = errors[i];
+    }
+    try
+    {
+      if (error)
+      {
+        std::rethrow_exception(error);
+      }
+      F result(std::move(results[0]));
+      for (size_t i = 1; i < count; ++i)
+      {
+        result = combine(std::move(result), std::move(results[i]));
+      }
+      detail::destroyResults(results, errors, count);
+      return result;
+    }
+    catch (...)
+    {
+      detail::destroyResults(results, errors, count);
+      throw;
+    }
+  }
+}
+#endif
@@ -10,74 +10,74 @@
 
 namespace kiselev
 {
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Augment >
   class RBTree;
 
   namespace detail
   {
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
     class RnlIterator: public std::iterator< std::forward_iterator_tag, std::pair< Key, Value > >
     {
     public:
       using value = std::pair< Key, Value >;
       using reference = std::conditional_t< IsConst, const value&, value& >;
       using pointer = std::conditional_t< IsConst, const value*, value* >;
-      using Node = TreeNode< Key, Value >;
+      using Node = TreeNode< Key, Value, Augment >;
 
       RnlIterator() noexcept;
       template < bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > = 0 >
-      RnlIterator(const RnlIterator< Key, Value, Cmp, OtherIsConst >&) noexcept;
+      RnlIterator(const RnlIterator< Key, Value, Cmp, Augment, OtherIsConst >&) noexcept;
       template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > = 0 >
-      RnlIterator< Key, Value, Cmp, IsConst >& operator=(const RnlIterator< Key, Value, Cmp, OtherIsConst >&) noexcept;
+      RnlIterator< Key, Value, Cmp, Augment, IsConst >& operator=(const RnlIterator< Key, Value, Cmp, Augment, OtherIsConst >&) noexcept;
 
-      RnlIterator< Key, Value, Cmp, IsConst > operator++();
-      RnlIterator< Key, Value, Cmp, IsConst > operator++(int);
+      RnlIterator< Key, Value, Cmp, Augment, IsConst > operator++();
+      RnlIterator< Key, Value, Cmp, Augment, IsConst > operator++(int);
 
       reference operator*() const noexcept;
       pointer operator->() const noexcept;
 
-      bool operator==(const RnlIterator< Key, Value, Cmp, IsConst >&) const noexcept;
-      bool operator!=(const RnlIterator< Key, Value, Cmp, IsConst >&) const noexcept;
+      bool operator==(const RnlIterator< Key, Value, Cmp, Augment, IsConst >&) const noexcept;
+      bool operator!=(const RnlIterator< Key, Value, Cmp, Augment, IsConst >&) const noexcept;
 
     private:
       Node* node_;
       Stack< Node* > stack_;
       explicit RnlIterator(Node*) noexcept;
-      friend class RnlIterator< Key, Value, Cmp, !IsConst >;
-      friend class RBTree< Key, Value, Cmp >;
+      friend class RnlIterator< Key, Value, Cmp, Augment, !IsConst >;
+      friend class RBTree< Key, Value, Cmp, Augment >;
     };
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    RnlIterator< Key, Value, Cmp, IsConst >::RnlIterator() noexcept:
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    RnlIterator< Key, Value, Cmp, Augment, IsConst >::RnlIterator() noexcept:
       node_(nullptr),
       stack_()
     {}
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
     template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > >
-    RnlIterator< Key, Value, Cmp, IsConst >::RnlIterator(const RnlIterator< Key, Value, Cmp, OtherIsConst >& oth) noexcept:
+    RnlIterator< Key, Value, Cmp, Augment, IsConst >::RnlIterator(const RnlIterator< Key, Value, Cmp, Augment, OtherIsConst >& oth) noexcept:
       node_(oth.node_),
       stack_(oth.stack_)
     {}
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
     template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > >
-    RnlIterator< Key, Value, Cmp, IsConst >& RnlIterator< Key, Value, Cmp, IsConst >::operator=(
-      const RnlIterator< Key, Value, Cmp, OtherIsConst >& oth) noexcept
+    RnlIterator< Key, Value, Cmp, Augment, IsConst >& RnlIterator< Key, Value, Cmp, Augment, IsConst >::operator=(
+      const RnlIterator< Key, Value, Cmp, Augment, OtherIsConst >& oth) noexcept
     {
       node_ = oth.node_;
       stack_ = oth.stack_;
       return *this;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    RnlIterator< Key, Value, Cmp, IsConst >::RnlIterator(Node* node) noexcept:
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    RnlIterator< Key, Value, Cmp, Augment, IsConst >::RnlIterator(Node* node) noexcept:
       node_(node),
       stack_()
     {}
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    RnlIterator< Key, Value, Cmp, IsConst > RnlIterator< Key, Value, Cmp, IsConst >::operator++()
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    RnlIterator< Key, Value, Cmp, Augment, IsConst > RnlIterator< Key, Value, Cmp, Augment, IsConst >::operator++()
     {
       if (!node_)
       {
@@ -115,36 +115,36 @@ namespace kiselev
       return *this;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    RnlIterator< Key, Value, Cmp, IsConst > RnlIterator< Key, Value, Cmp, IsConst >::operator++(int)
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    RnlIterator< Key, Value, Cmp, Augment, IsConst > RnlIterator< Key, Value, Cmp, Augment, IsConst >::operator++(int)
     {
-      RnlIterator< Key, Value, Cmp, IsConst > result(*this);
+      RnlIterator< Key, Value, Cmp, Augment, IsConst > result(*this);
       ++(*this);
       return result;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    typename RnlIterator< Key, Value, Cmp, IsConst >::reference RnlIterator< Key, Value, Cmp, IsConst >::operator*() const noexcept
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    typename RnlIterator< Key, Value, Cmp, Augment, IsConst >::reference RnlIterator< Key, Value, Cmp, Augment, IsConst >::operator*() const noexcept
     {
       assert(node_ != nullptr);
       return node_->data;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    typename RnlIterator< Key, Value, Cmp, IsConst >::pointer RnlIterator< Key, Value, Cmp, IsConst >::operator->() const noexcept
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    typename RnlIterator< Key, Value, Cmp, Augment, IsConst >::pointer RnlIterator< Key, Value, Cmp, Augment, IsConst >::operator->() const noexcept
     {
       assert(node_ != nullptr);
       return std::addressof(node_->data);
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    bool RnlIterator< Key, Value, Cmp, IsConst >::operator==(const RnlIterator< Key, Value, Cmp, IsConst >& oth) const noexcept
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    bool RnlIterator< Key, Value, Cmp, Augment, IsConst >::operator==(const RnlIterator< Key, Value, Cmp, Augment, IsConst >& oth) const noexcept
     {
       return node_ == oth.node_;
     }
 
-    template< typename Key, typename Value, typename Cmp, bool IsConst >
-    bool RnlIterator< Key, Value, Cmp, IsConst >::operator!=(const RnlIterator< Key, Value, Cmp, IsConst >& oth) const noexcept
+    template< typename Key, typename Value, typename Cmp, typename Augment, bool IsConst >
+    bool RnlIterator< Key, Value, Cmp, Augment, IsConst >::operator!=(const RnlIterator< Key, Value, Cmp, Augment, IsConst >& oth) const noexcept
     {
       return !(*this == oth);
     }
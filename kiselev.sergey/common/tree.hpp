@@ -1,6 +1,7 @@
 #ifndef TREE_HPP
 #define TREE_HPP
 #include <initializer_list>
+#include <limits>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
@@ -8,37 +9,41 @@
 #include "lnrIterator.hpp"
 #include "rnlIterator.hpp"
 #include "breadthIterator.hpp"
+#include "breadthTraversal.hpp"
 #include "treeNode.hpp"
+#include "treeAugment.hpp"
 
 namespace kiselev
 {
-  template< typename Key, typename Value, typename Cmp = std::less< Key > >
+  template< typename Key, typename Value, typename Cmp = std::less< Key >, typename Augment = NoAugment >
   class RBTree
   {
   public:
     using value = std::pair< Key, Value >;
-    using Iterator = detail::Iterator< Key, Value, Cmp, false >;
-    using ConstIterator = detail::Iterator< Key, Value, Cmp, true >;
-    using LnrIterator = detail::LnrIterator< Key, Value, Cmp, false >;
-    using ConstLnrIterator = detail::LnrIterator< Key, Value, Cmp, true >;
-    using RnlIterator = detail::RnlIterator< Key, Value, Cmp, false >;
-    using ConstRnlIterator = detail::RnlIterator< Key, Value, Cmp, true >;
-    using BreadthIterator = detail::BreadthIterator< Key, Value, Cmp, false >;
-    using ConstBreadthIterator = detail::BreadthIterator< Key, Value, Cmp, true >;
+    using Iterator = detail::Iterator< Key, Value, Cmp, Augment, false >;
+    using ConstIterator = detail::Iterator< Key, Value, Cmp, Augment, true >;
+    using LnrIterator = detail::LnrIterator< Key, Value, Cmp, Augment, false >;
+    using ConstLnrIterator = detail::LnrIterator< Key, Value, Cmp, Augment, true >;
+    using RnlIterator = detail::RnlIterator< Key, Value, Cmp, Augment, false >;
+    using ConstRnlIterator = detail::RnlIterator< Key, Value, Cmp, Augment, true >;
+    using BreadthIterator = detail::BreadthIterator< Key, Value, Cmp, Augment, false >;
+    using ConstBreadthIterator = detail::BreadthIterator< Key, Value, Cmp, Augment, true >;
+    using BreadthTraversal = detail::BreadthTraversal< Key, Value, Cmp, Augment, false >;
+    using ConstBreadthTraversal = detail::BreadthTraversal< Key, Value, Cmp, Augment, true >;
     using IteratorPair = std::pair< Iterator, Iterator >;
     using ConstIteratorPair = std::pair< ConstIterator, ConstIterator >;
 
     RBTree();
-    RBTree(const RBTree< Key, Value, Cmp >&);
-    RBTree(RBTree< Key, Value, Cmp >&&) noexcept;
+    RBTree(const RBTree< Key, Value, Cmp, Augment >&);
+    RBTree(RBTree< Key, Value, Cmp, Augment >&&) noexcept;
     RBTree(std::initializer_list< value >);
     template< typename InputIt >
     RBTree(InputIt first, InputIt last);
     ~RBTree();
 
-    RBTree< Key, Value, Cmp >& operator=(const RBTree< Key, Value, Cmp >&);
-    RBTree< Key, Value, Cmp >& operator=(RBTree< Key, Value, Cmp >&&) noexcept;
-    RBTree< Key, Value, Cmp >& operator=(std::initializer_list< value >);
+    RBTree< Key, Value, Cmp, Augment >& operator=(const RBTree< Key, Value, Cmp, Augment >&);
+    RBTree< Key, Value, Cmp, Augment >& operator=(RBTree< Key, Value, Cmp, Augment >&&) noexcept;
+    RBTree< Key, Value, Cmp, Augment >& operator=(std::initializer_list< value >);
     Value& operator[](const Key&);
     const Value& operator[](const Key&) const;
 
@@ -67,6 +72,9 @@ namespace kiselev
     BreadthIterator breadthEnd() noexcept;
     ConstBreadthIterator breadthCend() const noexcept;
 
+    BreadthTraversal breadthTraversal();
+    ConstBreadthTraversal breadthCtraversal() const;
+
     template< typename F >
     F traverse_lnr(F f) const;
     template< typename F >
@@ -94,7 +102,7 @@ namespace kiselev
     template< typename... Args >
     Iterator emplaceHint(ConstIterator, Args&&...);
 
-    void swap(RBTree< Key, Value, Cmp >&) noexcept;
+    void swap(RBTree< Key, Value, Cmp, Augment >&) noexcept;
     void clear() noexcept;
 
     Iterator find(const Key&) noexcept;
@@ -107,45 +115,62 @@ namespace kiselev
     std::pair< Iterator, Iterator > equalRange(const Key&) noexcept;
     std::pair< ConstIterator, ConstIterator > equalRange(const Key&) const noexcept;
 
-    TreeNode< Key, Value >* getMax() const noexcept;
+    Iterator select(size_t) noexcept;
+    ConstIterator select(size_t) const noexcept;
+    size_t rank(const Key&) const noexcept;
+    size_t countRange(const Key&, const Key&) const noexcept;
+    Key rangeSum(const Key&, const Key&) const;
+
+    TreeNode< Key, Value, Augment >* getMax() const noexcept;
 
   private:
-    using Node = TreeNode< Key, Value>;
+    using Node = TreeNode< Key, Value, Augment >;
 
     void rotateLeft(Node* node) noexcept;
     void rotateRight(Node* node) noexcept;
     void fixInsert(Node* node) noexcept;
-    void fixDelete(Node* node) noexcept;
+    void fixDelete(Node* node, Node* parent) noexcept;
+    void transplant(Node* node, Node* child) noexcept;
+    std::pair< Iterator, bool > insertNode(Node* newNode);
+    void attachNode(Node* newNode, Node* parent, bool isLeft) noexcept;
+    void updateToRoot(Node* node) noexcept;
+    Node* selectNode(size_t) const noexcept;
+    size_t countLess(const Key&, bool) const noexcept;
+    template< typename K, typename V, typename C, typename A, typename F, typename Combine >
+    friend F parallel_reduce(const RBTree< K, V, C, A >&, F, Combine, size_t);
     Node* root_;
+    Node* rightmost_;
     Cmp cmp_;
     size_t size_;
   };
 
-  template< typename Key, typename Value, typename Cmp >
-  RBTree< Key, Value, Cmp >::RBTree():
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  RBTree< Key, Value, Cmp, Augment >::RBTree():
     root_(nullptr),
+    rightmost_(nullptr),
     size_(0)
   {}
 
-  template< typename Key, typename Value, typename Cmp >
-  RBTree< Key, Value, Cmp >::RBTree(const RBTree< Key, Value, Cmp >& tree):
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  RBTree< Key, Value, Cmp, Augment >::RBTree(const RBTree< Key, Value, Cmp, Augment >& tree):
     RBTree()
   {
     for (ConstIterator it = tree.cbegin(); it != tree.cend(); ++it)
     {
-      insert(*it);
+      insert(cend(), *it);
     }
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  RBTree< Key, Value, Cmp >::RBTree(RBTree< Key, Value, Cmp >&& tree) noexcept:
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  RBTree< Key, Value, Cmp, Augment >::RBTree(RBTree< Key, Value, Cmp, Augment >&& tree) noexcept:
     root_(std::exchange(tree.root_, nullptr)),
+    rightmost_(std::exchange(tree.rightmost_, nullptr)),
     size_(std::exchange(tree.size_, 0))
   {}
 
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Augment >
   template< typename InputIt >
-  RBTree< Key, Value, Cmp >::RBTree(InputIt first, InputIt last):
+  RBTree< Key, Value, Cmp, Augment >::RBTree(InputIt first, InputIt last):
     RBTree()
   {
     for (; first != last; first++)
@@ -153,49 +178,49 @@ namespace kiselev
       insert(*first);
     }
   }
-  template< typename Key, typename Value, typename Cmp >
-  RBTree< Key, Value, Cmp >::RBTree(std::initializer_list< value > il):
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  RBTree< Key, Value, Cmp, Augment >::RBTree(std::initializer_list< value > il):
     RBTree(il.begin(), il.end())
   {}
 
-  template< typename Key, typename Value, typename Cmp >
-  RBTree< Key, Value, Cmp >& RBTree< Key, Value, Cmp >::operator=(const RBTree< Key, Value, Cmp >& tree)
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  RBTree< Key, Value, Cmp, Augment >& RBTree< Key, Value, Cmp, Augment >::operator=(const RBTree< Key, Value, Cmp, Augment >& tree)
   {
-    RBTree< Key, Value, Cmp > cpy(tree);
+    RBTree< Key, Value, Cmp, Augment > cpy(tree);
     swap(cpy);
     return *this;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  RBTree< Key, Value, Cmp >& RBTree< Key, Value, Cmp >::operator=(RBTree< Key, Value, Cmp >&& tree) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  RBTree< Key, Value, Cmp, Augment >& RBTree< Key, Value, Cmp, Augment >::operator=(RBTree< Key, Value, Cmp, Augment >&& tree) noexcept
   {
-    RBTree< Key, Value, Cmp > temp(std::move(tree));
+    RBTree< Key, Value, Cmp, Augment > temp(std::move(tree));
     swap(temp);
     return *this;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  RBTree< Key, Value, Cmp >& RBTree< Key, Value, Cmp >::operator=(std::initializer_list< value > il)
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  RBTree< Key, Value, Cmp, Augment >& RBTree< Key, Value, Cmp, Augment >::operator=(std::initializer_list< value > il)
   {
-    RBTree< Key, Value, Cmp > temp(il);
+    RBTree< Key, Value, Cmp, Augment > temp(il);
     swap(temp);
     return *this;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  RBTree< Key, Value, Cmp >::~RBTree()
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  RBTree< Key, Value, Cmp, Augment >::~RBTree()
   {
     clear();
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  void RBTree< Key, Value, Cmp >::clear() noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  void RBTree< Key, Value, Cmp, Augment >::clear() noexcept
   {
     erase(begin(), end());
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  void RBTree< Key, Value, Cmp >::rotateLeft(Node* node) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  void RBTree< Key, Value, Cmp, Augment >::rotateLeft(Node* node) noexcept
   {
     Node* child = node->right;
     node->right = child->left;
@@ -218,10 +243,12 @@ namespace kiselev
     }
     child->left = node;
     node->parent = child;
+    Augment::update(node);
+    Augment::update(child);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  void RBTree< Key, Value, Cmp >::rotateRight(Node* node) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  void RBTree< Key, Value, Cmp, Augment >::rotateRight(Node* node) noexcept
   {
     Node* child = node->left;
     node->left = child->right;
@@ -244,10 +271,12 @@ namespace kiselev
     }
     child->right = node;
     node->parent = child;
+    Augment::update(node);
+    Augment::update(child);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  void RBTree< Key, Value, Cmp >::fixInsert(Node* node) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  void RBTree< Key, Value, Cmp, Augment >::fixInsert(Node* node) noexcept
   {
     Node* parent = nullptr;
     Node* grandParent = nullptr;
@@ -305,82 +334,72 @@ namespace kiselev
     root_->color = Color::BLACK;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  void RBTree< Key, Value, Cmp >::fixDelete(Node* node) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  void RBTree< Key, Value, Cmp, Augment >::fixDelete(Node* node, Node* parent) noexcept
   {
-    while (node != root_ && node->color == Color::BLACK)
+    while (node != root_ && (!node || node->color == Color::BLACK))
     {
-      if (node == node->parent->left)
+      if (node == parent->left)
       {
-        Node* brother = node->parent->right;
-        if (brother && brother->color == Color::RED)
+        Node* brother = parent->right;
+        if (brother->color == Color::RED)
         {
           brother->color = Color::BLACK;
-          node->parent->color = Color::RED;
-          rotateLeft(node->parent);
-          brother = node->parent->right;
+          parent->color = Color::RED;
+          rotateLeft(parent);
+          brother = parent->right;
         }
         if ((!brother->left || brother->left->color == Color::BLACK) && (!brother->right || brother->right->color == Color::BLACK))
         {
           brother->color = Color::RED;
-          node = node->parent;
+          node = parent;
+          parent = node->parent;
         }
         else
         {
           if (!brother->right || brother->right->color == Color::BLACK)
           {
-            if (brother->left)
-            {
-              brother->left->color = Color::BLACK;
-            }
+            brother->left->color = Color::BLACK;
             brother->color = Color::RED;
             rotateRight(brother);
-            brother = node->parent->right;
-          }
-          brother->color = node->parent->color;
-          node->parent->color = Color::BLACK;
-          if (brother->right)
-          {
-            brother->right->color = Color::BLACK;
+            brother = parent->right;
           }
-          rotateLeft(node->parent);
+          brother->color = parent->color;
+          parent->color = Color::BLACK;
+          brother->right->color = Color::BLACK;
+          rotateLeft(parent);
           node = root_;
         }
       }
       else
       {
-        Node* brother = node->parent->left;
-        if (brother && brother->color == Color::RED)
+        Node* brother = parent->left;
+        if (brother->color == Color::RED)
         {
           brother->color = Color::BLACK;
-          node->parent->color = Color::RED;
-          rotateRight(node->parent);
-          brother = node->parent->left;
+          parent->color = Color::RED;
+          rotateRight(parent);
+          brother = parent->left;
         }
         if ((!brother->left || brother->left->color == Color::BLACK) && (!brother->right || brother->right->color == Color::BLACK))
         {
           brother->color = Color::RED;
-          node = node->parent;
+          node = parent;
+          parent = node->parent;
         }
         else
         {
           if (!brother->left || brother->left->color == Color::BLACK)
           {
-            if (brother->right)
-            {
-              brother->right->color = Color::BLACK;
-            }
+            brother->right->color = Color::BLACK;
             brother->color = Color::RED;
             rotateLeft(brother);
-            brother = node->parent->left;
+            brother = parent->left;
           }
-          brother->color = node->parent->color;
-          node->parent->color = Color::BLACK;
-          if (brother->left)
-          {
-            brother->left->color = Color::BLACK;
-          }
-          rotateRight(node->parent);
+          brother->color = parent->color;
+          parent->color = Color::BLACK;
+          brother->left->color = Color::BLACK;
+          rotateRight(parent);
           node = root_;
         }
       }
@@ -391,27 +410,63 @@ namespace kiselev
     }
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  size_t RBTree< Key, Value, Cmp >::size() const noexcept
+
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  void RBTree< Key, Value, Cmp, Augment >::transplant(Node* node, Node* child) noexcept
+  {
+    if (!node->parent)
+    {
+      root_ = child;
+    }
+    else if (node == node->parent->left)
+    {
+      node->parent->left = child;
+    }
+    else
+    {
+      node->parent->right = child;
+    }
+    if (child)
+    {
+      child->parent = node->parent;
+    }
+  }
+
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  void RBTree< Key, Value, Cmp, Augment >::updateToRoot(Node* node) noexcept
+  {
+    if (!Augment::enabled)
+    {
+      return;
+    }
+    for (; node; node = node->parent)
+    {
+      Augment::update(node);
+    }
+  }
+
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  size_t RBTree< Key, Value, Cmp, Augment >::size() const noexcept
   {
     return size_;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  bool RBTree< Key, Value, Cmp >::empty() const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  bool RBTree< Key, Value, Cmp, Augment >::empty() const noexcept
   {
     return size_ == 0;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  void RBTree< Key, Value, Cmp >::swap(RBTree< Key, Value, Cmp >& tree) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  void RBTree< Key, Value, Cmp, Augment >::swap(RBTree< Key, Value, Cmp, Augment >& tree) noexcept
   {
     std::swap(root_, tree.root_);
+    std::swap(rightmost_, tree.rightmost_);
     std::swap(size_, tree.size_);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::begin() noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::Iterator RBTree< Key, Value, Cmp, Augment >::begin() noexcept
   {
     if (empty())
     {
@@ -425,8 +480,8 @@ namespace kiselev
     return Iterator(temp, false);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstIterator RBTree< Key, Value, Cmp >::cbegin() const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::ConstIterator RBTree< Key, Value, Cmp, Augment >::cbegin() const noexcept
   {
     if (empty())
     {
@@ -440,38 +495,20 @@ namespace kiselev
     return ConstIterator(temp, false);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::end() noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::Iterator RBTree< Key, Value, Cmp, Augment >::end() noexcept
   {
-    if (empty())
-    {
-      return Iterator(root_, true);
-    }
-    Node* temp = root_;
-    while (temp->right)
-    {
-      temp = temp->right;
-    }
-    return Iterator(temp, true);
+    return Iterator(rightmost_, true);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstIterator RBTree< Key, Value, Cmp >::cend() const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::ConstIterator RBTree< Key, Value, Cmp, Augment >::cend() const noexcept
   {
-    if (empty())
-    {
-      return ConstIterator(root_, true);
-    }
-    Node* temp = root_;
-    while (temp->right)
-    {
-      temp = temp->right;
-    }
-    return ConstIterator(temp, true);
+    return ConstIterator(rightmost_, true);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp>::LnrIterator RBTree< Key, Value, Cmp >::lnrBegin()
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::LnrIterator RBTree< Key, Value, Cmp, Augment >::lnrBegin()
   {
     if (empty())
     {
@@ -486,8 +523,8 @@ namespace kiselev
     return it;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstLnrIterator RBTree< Key, Value, Cmp >::lnrCbegin() const
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::ConstLnrIterator RBTree< Key, Value, Cmp, Augment >::lnrCbegin() const
   {
     if (empty())
     {
@@ -502,20 +539,20 @@ namespace kiselev
     return it;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::LnrIterator RBTree< Key, Value, Cmp >::lnrEnd() noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::LnrIterator RBTree< Key, Value, Cmp, Augment >::lnrEnd() noexcept
   {
     return LnrIterator(nullptr);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstLnrIterator RBTree< Key, Value, Cmp >::lnrCend() const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::ConstLnrIterator RBTree< Key, Value, Cmp, Augment >::lnrCend() const noexcept
   {
     return ConstLnrIterator(nullptr);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::RnlIterator RBTree< Key, Value, Cmp >::rnlBegin()
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::RnlIterator RBTree< Key, Value, Cmp, Augment >::rnlBegin()
   {
     if (empty())
     {
@@ -530,8 +567,8 @@ namespace kiselev
     return it;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstRnlIterator RBTree< Key, Value, Cmp >::rnlCbegin() const
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::ConstRnlIterator RBTree< Key, Value, Cmp, Augment >::rnlCbegin() const
   {
     if (empty())
     {
@@ -546,45 +583,57 @@ namespace kiselev
     return it;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::RnlIterator RBTree< Key, Value, Cmp >::rnlEnd() noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::RnlIterator RBTree< Key, Value, Cmp, Augment >::rnlEnd() noexcept
   {
     return RnlIterator(nullptr);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstRnlIterator RBTree< Key, Value, Cmp >::rnlCend() const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::ConstRnlIterator RBTree< Key, Value, Cmp, Augment >::rnlCend() const noexcept
   {
     return ConstRnlIterator(nullptr);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::BreadthIterator RBTree< Key, Value, Cmp >::breadthBegin() noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::BreadthIterator RBTree< Key, Value, Cmp, Augment >::breadthBegin() noexcept
   {
     return BreadthIterator(root_);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstBreadthIterator RBTree< Key, Value, Cmp >::breadthCbegin() const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::ConstBreadthIterator RBTree< Key, Value, Cmp, Augment >::breadthCbegin() const noexcept
   {
     return ConstBreadthIterator(root_);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::BreadthIterator RBTree< Key, Value, Cmp >::breadthEnd() noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::BreadthIterator RBTree< Key, Value, Cmp, Augment >::breadthEnd() noexcept
   {
     return BreadthIterator(nullptr);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstBreadthIterator RBTree< Key, Value, Cmp >::breadthCend() const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::ConstBreadthIterator RBTree< Key, Value, Cmp, Augment >::breadthCend() const noexcept
   {
     return ConstBreadthIterator(nullptr);
   }
 
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::BreadthTraversal RBTree< Key, Value, Cmp, Augment >::breadthTraversal()
+  {
+    return BreadthTraversal(root_, size_);
+  }
+
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::ConstBreadthTraversal RBTree< Key, Value, Cmp, Augment >::breadthCtraversal() const
+  {
+    return ConstBreadthTraversal(root_, size_);
+  }
+
+  template< typename Key, typename Value, typename Cmp, typename Augment >
   template< typename F >
-  F RBTree< Key, Value, Cmp >::traverse_lnr(F f) const
+  F RBTree< Key, Value, Cmp, Augment >::traverse_lnr(F f) const
   {
     for (ConstLnrIterator it = lnrCbegin(); it != lnrCend(); ++it)
     {
@@ -593,9 +642,9 @@ namespace kiselev
     return f;
   }
 
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Augment >
   template< typename F >
-  F RBTree< Key, Value, Cmp >::traverse_rnl(F f) const
+  F RBTree< Key, Value, Cmp, Augment >::traverse_rnl(F f) const
   {
     for (ConstRnlIterator it = rnlCbegin(); it != rnlCend(); ++it)
     {
@@ -604,19 +653,20 @@ namespace kiselev
     return f;
   }
 
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Augment >
   template< typename F >
-  F RBTree< Key, Value, Cmp >::traverse_breadth(F f) const
+  F RBTree< Key, Value, Cmp, Augment >::traverse_breadth(F f) const
   {
-    for (ConstBreadthIterator it = breadthCbegin(); it != breadthCend(); ++it)
+    ConstBreadthTraversal traversal = breadthCtraversal();
+    for (typename ConstBreadthTraversal::Handle it = traversal.begin(); it != traversal.end(); ++it)
     {
       f(*(it));
     }
     return f;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::find(const Key& key) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::Iterator RBTree< Key, Value, Cmp, Augment >::find(const Key& key) noexcept
   {
     Node* temp = root_;
     while (temp)
@@ -637,8 +687,8 @@ namespace kiselev
     return end();
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstIterator RBTree< Key, Value, Cmp >::find(const Key& key) const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::ConstIterator RBTree< Key, Value, Cmp, Augment >::find(const Key& key) const noexcept
   {
     Node* temp = root_;
     while (temp)
@@ -659,25 +709,32 @@ namespace kiselev
     return cend();
   }
 
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Augment >
   template< typename... Args >
-  std::pair< typename RBTree< Key, Value, Cmp >::Iterator, bool > RBTree< Key, Value, Cmp >::emplace(Args &&... args)
+  std::pair< typename RBTree< Key, Value, Cmp, Augment >::Iterator, bool > RBTree< Key, Value, Cmp, Augment >::emplace(Args &&... args)
+  {
+    Node* newNode = new Node{ Color::RED, nullptr, nullptr, nullptr, { std::forward< Args >(args)... } };
+    return insertNode(newNode);
+  }
+
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  std::pair< typename RBTree< Key, Value, Cmp, Augment >::Iterator, bool > RBTree< Key, Value, Cmp, Augment >::insertNode(Node* newNode)
   {
-    Node* newNode = new Node{ Color::BLACK, nullptr, nullptr, nullptr, { std::forward< Args >(args)... } };
     try
     {
       if (!root_)
       {
-        root_ = newNode;
-        size_ = 1;
-        return { Iterator(root_, false), true };
+        attachNode(newNode, nullptr, false);
+        return { Iterator(newNode, false), true };
       }
       Node* temp = root_;
       Node* parent = nullptr;
+      bool isLeft = false;
       while (temp)
       {
         parent = temp;
-        if (cmp_(newNode->data.first, temp->data.first))
+        isLeft = cmp_(newNode->data.first, temp->data.first);
+        if (isLeft)
         {
           temp = temp->left;
         }
@@ -691,112 +748,178 @@ namespace kiselev
           return { Iterator(temp, false), false };
         }
       }
-
-      newNode->parent = parent;
-      newNode->color = Color::RED;
-      if (cmp_(parent->data.first, newNode->data.first))
-      {
-        parent->right = newNode;
-      }
-      else
-      {
-        parent->left = newNode;
-      }
+      attachNode(newNode, parent, isLeft);
     }
     catch (...)
     {
       delete newNode;
       throw;
     }
+    return { Iterator(newNode, false), true };
+  }
+
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  void RBTree< Key, Value, Cmp, Augment >::attachNode(Node* newNode, Node* parent, bool isLeft) noexcept
+  {
+    newNode->parent = parent;
+    if (!parent)
+    {
+      root_ = newNode;
+    }
+    else if (isLeft)
+    {
+      parent->left = newNode;
+    }
+    else
+    {
+      parent->right = newNode;
+    }
+    if (!parent || (!isLeft && parent == rightmost_))
+    {
+      rightmost_ = newNode;
+    }
+    updateToRoot(newNode);
     fixInsert(newNode);
     size_++;
-    return { Iterator(newNode, false), true };
   }
 
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Augment >
   template< typename... Args >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::emplaceHint(ConstIterator hint, Args &&... args)
+  typename RBTree< Key, Value, Cmp, Augment >::Iterator RBTree< Key, Value, Cmp, Augment >::emplaceHint(ConstIterator hint, Args &&... args)
   {
-    if (hint == cend() || empty())
+    Node* newNode = new Node{ Color::RED, nullptr, nullptr, nullptr, { std::forward< Args >(args)... } };
+    if (empty())
     {
-      return emplace(std::forward< Args >(args)...).first;
+      return insertNode(newNode).first;
     }
-    Node* pos = hint.node_;
-    Node* newNode = new Node{ Color::RED, nullptr, nullptr, pos, { std::forward< Args >(args)... } };
-    value val = newNode->data;
     try
     {
-      if (cmp_(val.first, pos->data.first))
+      const Key& key = newNode->data.first;
+      Node* pos = hint.node_;
+      if (hint.isEnd_)
       {
-        if (!pos->left)
+        if (cmp_(rightmost_->data.first, key))
         {
-          pos->left = newNode;
-          fixInsert(newNode);
-          ++size_;
+          attachNode(newNode, rightmost_, false);
           return Iterator(newNode, false);
         }
       }
-      else if (cmp_(pos->data.first, val.first))
+      else if (cmp_(pos->data.first, key))
       {
-        if (!pos->right)
+        if (pos == rightmost_)
         {
-          pos->right = newNode;
-          fixInsert(newNode);
-          ++size_;
+          attachNode(newNode, pos, false);
+          return Iterator(newNode, false);
+        }
+        Node* next = pos->right;
+        if (next)
+        {
+          while (next->left)
+          {
+            next = next->left;
+          }
+        }
+        else
+        {
+          Node* child = pos;
+          next = pos->parent;
+          while (next->right == child)
+          {
+            child = next;
+            next = next->parent;
+          }
+        }
+        if (cmp_(key, next->data.first))
+        {
+          if (pos->right)
+          {
+            attachNode(newNode, next, true);
+          }
+          else
+          {
+            attachNode(newNode, pos, false);
+          }
           return Iterator(newNode, false);
         }
       }
-      else
+      else if (cmp_(key, pos->data.first))
       {
-        delete newNode;
-        return Iterator(pos, false);
+        Node* prev = pos->left;
+        if (prev)
+        {
+          while (prev->right)
+          {
+            prev = prev->right;
+          }
+        }
+        else
+        {
+          Node* child = pos;
+          prev = pos->parent;
+          while (prev && prev->left == child)
+          {
+            child = prev;
+            prev = prev->parent;
+          }
+        }
+        if (!prev || cmp_(prev->data.first, key))
+        {
+          if (pos->left)
+          {
+            attachNode(newNode, prev, false);
+          }
+          else
+          {
+            attachNode(newNode, pos, true);
+          }
+          return Iterator(newNode, false);
+        }
       }
-      delete newNode;
-      return emplace(val).first;
     }
     catch (...)
     {
       delete newNode;
       throw;
     }
+    return insertNode(newNode).first;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  std::pair< typename RBTree< Key, Value, Cmp >::Iterator, bool > RBTree< Key, Value, Cmp >::insert(const value& val)
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  std::pair< typename RBTree< Key, Value, Cmp, Augment >::Iterator, bool > RBTree< Key, Value, Cmp, Augment >::insert(const value& val)
   {
     return emplace(val);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  std::pair< typename RBTree< Key, Value, Cmp >::Iterator, bool > RBTree< Key, Value, Cmp >::insert(value& val)
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  std::pair< typename RBTree< Key, Value, Cmp, Augment >::Iterator, bool > RBTree< Key, Value, Cmp, Augment >::insert(value& val)
   {
     return emplace(val);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  std::pair< typename RBTree< Key, Value, Cmp >::Iterator, bool > RBTree< Key, Value, Cmp >::insert(value&& val)
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  std::pair< typename RBTree< Key, Value, Cmp, Augment >::Iterator, bool > RBTree< Key, Value, Cmp, Augment >::insert(value&& val)
   {
     return emplace(std::move(val));
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::insert(ConstIterator pos, const value& val)
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::Iterator RBTree< Key, Value, Cmp, Augment >::insert(ConstIterator pos, const value& val)
   {
     return emplaceHint(pos, val);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::insert(Iterator pos, const value& val)
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::Iterator RBTree< Key, Value, Cmp, Augment >::insert(Iterator pos, const value& val)
   {
     ConstIterator it(pos);
     return emplaceHint(it, val);
   }
 
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Augment >
   template< typename InputIt >
-  void RBTree< Key, Value, Cmp >::insert(InputIt first, InputIt last)
+  void RBTree< Key, Value, Cmp, Augment >::insert(InputIt first, InputIt last)
   {
-    RBTree< Key, Value, Cmp > temp(*this);
+    RBTree< Key, Value, Cmp, Augment > temp(*this);
     for (; first != last; ++first)
     {
       temp.insert(*first);
@@ -804,31 +927,49 @@ namespace kiselev
     swap(temp);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  void RBTree< Key, Value, Cmp >::insert(std::initializer_list< value > il)
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  void RBTree< Key, Value, Cmp, Augment >::insert(std::initializer_list< value > il)
   {
     insert(il.begin(), il.end());
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::erase(ConstIterator pos) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::Iterator RBTree< Key, Value, Cmp, Augment >::erase(ConstIterator pos) noexcept
   {
     if (pos == cend())
     {
       return end();
     }
     Node* toDelete = pos.node_;
-    Node* replace = nullptr;
+    Iterator next(toDelete, false);
+    ++next;
+    if (toDelete == rightmost_)
+    {
+      rightmost_ = toDelete->parent;
+      if (toDelete->left)
+      {
+        rightmost_ = toDelete->left;
+        while (rightmost_->right)
+        {
+          rightmost_ = rightmost_->right;
+        }
+      }
+    }
+    Node* replace = toDelete;
+    Color deletedColor = replace->color;
     Node* child = nullptr;
-    if (size_ == 1)
+    Node* childParent = nullptr;
+    if (!toDelete->left)
     {
-      delete root_;
-      size_ = 0;
-      return end();
+      child = toDelete->right;
+      childParent = toDelete->parent;
+      transplant(toDelete, toDelete->right);
     }
-    if (!toDelete->left || !toDelete->right)
+    else if (!toDelete->right)
     {
-      replace = toDelete;
+      child = toDelete->left;
+      childParent = toDelete->parent;
+      transplant(toDelete, toDelete->left);
     }
     else
     {
@@ -837,48 +978,44 @@ namespace kiselev
       {
         replace = replace->left;
       }
+      deletedColor = replace->color;
+      child = replace->right;
+      if (replace->parent == toDelete)
+      {
+        childParent = replace;
+      }
+      else
+      {
+        childParent = replace->parent;
+        transplant(replace, replace->right);
+        replace->right = toDelete->right;
+        replace->right->parent = replace;
+      }
+      transplant(toDelete, replace);
+      replace->left = toDelete->left;
+      replace->left->parent = replace;
+      replace->color = toDelete->color;
     }
-    child = replace->left ? replace->left : replace->right;
-    if (child)
-    {
-      child->parent = replace->parent;
-    }
-    if (!replace->parent)
-    {
-      root_ = child;
-    }
-    else if (replace == replace->parent->left)
-    {
-      replace->parent->left = child;
-    }
-    else
-    {
-      replace->parent->right = child;
-    }
-    if (replace != toDelete)
-    {
-      toDelete->data = std::move(replace->data);
-    }
-    if (replace->color == Color::BLACK)
+    updateToRoot(childParent);
+    if (deletedColor == Color::BLACK)
     {
-      fixDelete(child ? child : replace->parent);
+      fixDelete(child, childParent);
     }
-    Iterator next(pos.node_, pos.isEnd_);
-    ++next;
-    delete replace;
+    delete toDelete;
     --size_;
-    return next;
+    return next.isEnd_ ? end() : next;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::erase(Iterator pos) noexcept
+
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::Iterator RBTree< Key, Value, Cmp, Augment >::erase(Iterator pos) noexcept
   {
     ConstIterator it(pos);
     return erase(it);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  size_t RBTree< Key, Value, Cmp >::erase(const Key& key) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  size_t RBTree< Key, Value, Cmp, Augment >::erase(const Key& key) noexcept
   {
     Iterator it = find(key);
     if (it == end())
@@ -889,33 +1026,33 @@ namespace kiselev
     return 1;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::erase(ConstIterator first, ConstIterator last) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::Iterator RBTree< Key, Value, Cmp, Augment >::erase(ConstIterator first, ConstIterator last) noexcept
   {
-    while (first != last)
+    while (first != last && !first.isEnd_)
     {
       first = erase(first);
     }
-    return Iterator(last.node_, last.isEnd_);
+    return last.isEnd_ ? end() : Iterator(last.node_, false);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::erase(Iterator first, Iterator last) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::Iterator RBTree< Key, Value, Cmp, Augment >::erase(Iterator first, Iterator last) noexcept
   {
     ConstIterator constFirst(first);
     ConstIterator constLast(last);
     return erase(constFirst, constLast);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  size_t RBTree< Key, Value, Cmp >::count(const Key& key) const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  size_t RBTree< Key, Value, Cmp, Augment >::count(const Key& key) const noexcept
   {
     ConstIterator it = find(key);
     return it == cend() ? 0 : 1;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::lowerBound(const Key& key) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::Iterator RBTree< Key, Value, Cmp, Augment >::lowerBound(const Key& key) noexcept
   {
     Node* temp = root_;
     Node* res = nullptr;
@@ -934,14 +1071,14 @@ namespace kiselev
     return res ? Iterator(res, false) : end();
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstIterator RBTree< Key, Value, Cmp >::lowerBound(const Key& key) const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::ConstIterator RBTree< Key, Value, Cmp, Augment >::lowerBound(const Key& key) const noexcept
   {
     return ConstIterator(lowerBound(key));
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::upperBound(const Key& key) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::Iterator RBTree< Key, Value, Cmp, Augment >::upperBound(const Key& key) noexcept
   {
     Node* temp = root_;
     Node* res = nullptr;
@@ -960,40 +1097,167 @@ namespace kiselev
     return res ? Iterator(res, false) : end();
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstIterator RBTree< Key, Value, Cmp >::upperBound(const Key& key) const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::ConstIterator RBTree< Key, Value, Cmp, Augment >::upperBound(const Key& key) const noexcept
   {
     return ConstIterator(upperBound(key));
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::IteratorPair RBTree< Key, Value, Cmp >::equalRange(const Key& key) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::IteratorPair RBTree< Key, Value, Cmp, Augment >::equalRange(const Key& key) noexcept
   {
     return { Iterator(lowerBound(key)), Iterator(upperBound(key)) };
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstIteratorPair RBTree< Key, Value, Cmp >::equalRange(const Key& key) const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::ConstIteratorPair RBTree< Key, Value, Cmp, Augment >::equalRange(const Key& key) const noexcept
   {
     return { ConstIterator(lowerBound(key)), ConstIterator(upperBound(key)) };
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  const Value& RBTree< Key, Value, Cmp >::operator[](const Key& key) const
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::Node* RBTree< Key, Value, Cmp, Augment >::selectNode(size_t k) const noexcept
+  {
+    static_assert(std::is_same< Augment, SubtreeSize >::value, "Order statistics require SubtreeSize augmentation");
+    Node* temp = root_;
+    while (temp)
+    {
+      size_t leftSize = SubtreeSize::get(temp->left);
+      if (k < leftSize)
+      {
+        temp = temp->left;
+      }
+      else if (k > leftSize)
+      {
+        k -= leftSize + 1;
+        temp = temp->right;
+      }
+      else
+      {
+        return temp;
+      }
+    }
+    return nullptr;
+  }
+
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::Iterator RBTree< Key, Value, Cmp, Augment >::select(size_t k) noexcept
+  {
+    Node* node = selectNode(k);
+    return node ? Iterator(node, false) : end();
+  }
+
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  typename RBTree< Key, Value, Cmp, Augment >::ConstIterator RBTree< Key, Value, Cmp, Augment >::select(size_t k) const noexcept
+  {
+    Node* node = selectNode(k);
+    return node ? ConstIterator(node, false) : cend();
+  }
+
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  size_t RBTree< Key, Value, Cmp, Augment >::countLess(const Key& key, bool inclusive) const noexcept
+  {
+    static_assert(std::is_same< Augment, SubtreeSize >::value, "Order statistics require SubtreeSize augmentation");
+    size_t result = 0;
+    Node* temp = root_;
+    while (temp)
+    {
+      bool isLess = inclusive ? !cmp_(key, temp->data.first) : cmp_(temp->data.first, key);
+      if (isLess)
+      {
+        result += SubtreeSize::get(temp->left) + 1;
+        temp = temp->right;
+      }
+      else
+      {
+        temp = temp->left;
+      }
+    }
+    return result;
+  }
+
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  size_t RBTree< Key, Value, Cmp, Augment >::rank(const Key& key) const noexcept
+  {
+    return countLess(key, false);
+  }
+
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  size_t RBTree< Key, Value, Cmp, Augment >::countRange(const Key& lo, const Key& hi) const noexcept
+  {
+    if (cmp_(hi, lo))
+    {
+      return 0;
+    }
+    return countLess(hi, true) - countLess(lo, false);
+  }
+
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  Key RBTree< Key, Value, Cmp, Augment >::rangeSum(const Key& lo, const Key& hi) const
+  {
+    static_assert(std::is_same< Augment, SubtreeSum< Key > >::value, "Range sums require SubtreeSum augmentation");
+    using Sum = SubtreeSum< Key >;
+    Node* split = root_;
+    while (split && (cmp_(split->data.first, lo) || cmp_(hi, split->data.first)))
+    {
+      split = cmp_(split->data.first, lo) ? split->right : split->left;
+    }
+    if (!split)
+    {
+      return Key();
+    }
+    typename Sum::type result = split->data.first;
+    for (Node* temp = split->left; temp;)
+    {
+      if (!cmp_(temp->data.first, lo))
+      {
+        result += temp->data.first + Sum::get(temp->right);
+        temp = temp->left;
+      }
+      else
+      {
+        temp = temp->right;
+      }
+    }
+    for (Node* temp = split->right; temp;)
+    {
+      if (!cmp_(hi, temp->data.first))
+      {
+        result += temp->data.first + Sum::get(temp->left);
+        temp = temp->right;
+      }
+      else
+      {
+        temp = temp->left;
+      }
+    }
+    if (result > std::numeric_limits< Key >::max())
+    {
+      throw std::logic_error("Overflow");
+    }
+    if (result < std::numeric_limits< Key >::min())
+    {
+      throw std::logic_error("Underflow");
+    }
+    return static_cast< Key >(result);
+  }
+
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  const Value& RBTree< Key, Value, Cmp, Augment >::operator[](const Key& key) const
   {
     ConstIterator it = find(key);
     return it->second;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  Value& RBTree< Key, Value, Cmp >::operator[](const Key& key)
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  Value& RBTree< Key, Value, Cmp, Augment >::operator[](const Key& key)
   {
     Iterator it = insert(std::make_pair(key, Value())).first;
     return it->second;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  const Value& RBTree< Key, Value, Cmp >::at(const Key& key) const
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  const Value& RBTree< Key, Value, Cmp, Augment >::at(const Key& key) const
   {
     ConstIterator it = find(key);
     if (it == cend())
@@ -1003,10 +1267,10 @@ namespace kiselev
     return it->second;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  Value& RBTree< Key, Value, Cmp >::at(const Key& key)
+  template< typename Key, typename Value, typename Cmp, typename Augment >
+  Value& RBTree< Key, Value, Cmp, Augment >::at(const Key& key)
   {
-    return const_cast< Value& >(static_cast< const RBTree< Key, Value, Cmp >& >(*this).at(key));
+    return const_cast< Value& >(static_cast< const RBTree< Key, Value, Cmp, Augment >& >(*this).at(key));
   }
 }
 #endif
@@ -0,0 +1,55 @@
+#ifndef TREEAUGMENT_HPP
+#define TREEAUGMENT_HPP
+#include <cstddef>
+#include <type_traits>
+
+namespace kiselev
+{
+  struct NoAugment
+  {
+    static constexpr bool enabled = false;
+
+    template< typename Node >
+    static void update(Node*) noexcept
+    {}
+  };
+
+  struct SubtreeSize
+  {
+    static constexpr bool enabled = true;
+    using type = size_t;
+
+    template< typename Node >
+    static size_t get(const Node* node) noexcept
+    {
+      return node ? node->augment : 0;
+    }
+
+    template< typename Node >
+    static void update(Node* node) noexcept
+    {
+      node->augment = 1 + get(node->left) + get(node->right);
+    }
+  };
+
+  template< typename T >
+  struct SubtreeSum
+  {
+    static_assert(std::is_integral< T >::value && (sizeof(T) < sizeof(long long)), "Subtree sums are kept in long long");
+    static constexpr bool enabled = true;
+    using type = long long;
+
+    template< typename Node >
+    static type get(const Node* node) noexcept
+    {
+      return node ? node->augment : 0;
+    }
+
+    template< typename Node >
+    static void update(Node* node) noexcept
+    {
+      node->augment = get(node->left) + node->data.first + get(node->right);
+    }
+  };
+}
+#endif
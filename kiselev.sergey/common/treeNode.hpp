@@ -1,6 +1,7 @@
 #ifndef TREENODE_HPP
 #define TREENODE_HPP
 #include <utility>
+#include "treeAugment.hpp"
 
 namespace kiselev
 {
@@ -9,8 +10,19 @@ namespace kiselev
     RED,
     BLACK
   };
-  template< class Key, class Value >
+  template< class Key, class Value, class Augment = NoAugment >
   struct TreeNode
+  {
+    Color color;
+    TreeNode* left;
+    TreeNode* right;
+    TreeNode* parent;
+    std::pair< Key, Value > data;
+    typename Augment::type augment;
+  };
+
+  template< class Key, class Value >
+  struct TreeNode< Key, Value, NoAugment >
   {
     Color color;
     TreeNode* left;
@@ -7,18 +7,20 @@
 
 namespace kizhin {
   std::istream& inputSequences(std::istream&, NamesT&, ForwardList< NumbersT >&);
-  template < typename T >
-  std::ostream& outputList(std::ostream&, const ForwardList< T >&);
+  template < typename Range >
+  std::ostream& outputList(std::ostream&, const Range&);
 }
 
-template < typename T >
-std::ostream& kizhin::outputList(std::ostream& out, const ForwardList< T >& list)
+template < typename Range >
+std::ostream& kizhin::outputList(std::ostream& out, const Range& range)
 {
-  if (list.empty()) {
+  auto i = range.begin();
+  const auto end = range.end();
+  if (i == end) {
     return out;
   }
-  out << list.front();
-  for (auto i = ++list.begin(), end = list.end(); i != end; ++i) {
+  out << *i;
+  for (++i; i != end; ++i) {
     out << ' ' << *i;
   }
   return out;
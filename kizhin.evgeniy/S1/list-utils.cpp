@@ -1,43 +1,109 @@
 #include "list-utils.hpp"
 #include <limits>
+#include <memory>
 #include <stdexcept>
 
-kizhin::ForwardList< kizhin::NumbersT > kizhin::transpose(
-    const ForwardList< NumbersT >& source)
-{
-  using NumberIter = NumbersT::const_iterator;
-  ForwardList< std::pair< NumberIter, NumberIter > > iters;
-  for (const auto& nums: source) {
-    iters.emplaceBack(nums.begin(), nums.end());
-  }
-  ForwardList< NumbersT > result;
-  bool isEmpty = false;
-  while (!isEmpty) {
-    NumbersT current;
-    for (auto& pair: iters) {
-      if (pair.first != pair.second) {
-        current.pushBack(*pair.first);
-        ++pair.first;
+namespace {
+  template < typename Range >
+  kizhin::NumbersT::value_type accumulateNumbers(const Range& nums,
+      kizhin::NumbersT::value_type init)
+  {
+    constexpr auto limit = std::numeric_limits< kizhin::NumbersT::value_type >::max();
+    for (const auto& num: nums) {
+      if (init > limit - num) {
+        throw std::overflow_error("Failed to compute sum because of an overflow");
       }
+      init += num;
     }
-    isEmpty = current.empty();
-    if (!isEmpty) {
-      result.pushBack(std::move(current));
+    return init;
+  }
+}
+
+kizhin::ColumnView::ColumnView(const ForwardList< NumbersT >& rows)
+{
+  for (const auto& nums: rows) {
+    if (!nums.empty()) {
+      cursors_.emplaceBack(nums.begin(), nums.end());
     }
   }
+}
+
+kizhin::ColumnView::const_iterator kizhin::ColumnView::begin() const noexcept
+{
+  return const_iterator(cursors_.begin());
+}
+
+kizhin::ColumnView::const_iterator kizhin::ColumnView::end() const noexcept
+{
+  return const_iterator(cursors_.end());
+}
+
+bool kizhin::ColumnView::empty() const noexcept
+{
+  return cursors_.empty();
+}
+
+kizhin::ColumnView& kizhin::ColumnView::operator++()
+{
+  for (auto& cursor: cursors_) {
+    ++cursor.first;
+  }
+  const auto isExhausted = [](const RowCursor& cursor) -> bool
+  {
+    return cursor.first == cursor.second;
+  };
+  cursors_.removeIf(isExhausted);
+  return *this;
+}
+
+kizhin::ColumnView::ConstIterator::ConstIterator(RowCursors::const_iterator cursor) noexcept:
+  cursor_(cursor)
+{}
+
+kizhin::ColumnView::ConstIterator::reference
+    kizhin::ColumnView::ConstIterator::operator*() const noexcept
+{
+  return *cursor_->first;
+}
+
+kizhin::ColumnView::ConstIterator::pointer
+    kizhin::ColumnView::ConstIterator::operator->() const noexcept
+{
+  return std::addressof(*cursor_->first);
+}
+
+kizhin::ColumnView::ConstIterator& kizhin::ColumnView::ConstIterator::operator++() noexcept
+{
+  ++cursor_;
+  return *this;
+}
+
+kizhin::ColumnView::ConstIterator kizhin::ColumnView::ConstIterator::operator++(int) noexcept
+{
+  ConstIterator result(*this);
+  ++(*this);
   return result;
 }
 
+bool kizhin::ColumnView::ConstIterator::operator==(const ConstIterator& rhs) const noexcept
+{
+  return cursor_ == rhs.cursor_;
+}
+
+bool kizhin::ColumnView::ConstIterator::operator!=(const ConstIterator& rhs) const noexcept
+{
+  return !(*this == rhs);
+}
+
 kizhin::NumbersT::value_type kizhin::safeAccumulate(const NumbersT& nums,
     NumbersT::value_type init)
 {
-  constexpr auto limit = std::numeric_limits< NumbersT::value_type >::max();
-  for (const auto& num: nums) {
-    if (init > limit - num) {
-      throw std::overflow_error("Failed to compute sum because of an overflow");
-    }
-    init += num;
-  }
-  return init;
+  return accumulateNumbers(nums, init);
+}
+
+kizhin::NumbersT::value_type kizhin::safeAccumulate(const ColumnView& column,
+    NumbersT::value_type init)
+{
+  return accumulateNumbers(column, init);
 }
 
@@ -1,17 +1,65 @@
 #ifndef SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S1_LIST_UTILS_HPP
 #define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S1_LIST_UTILS_HPP
 
+#include <cstddef>
+#include <iterator>
+#include <utility>
 #include <forward-list.hpp>
 #include "type-utils.hpp"
 
 namespace kizhin {
-  NumbersT::value_type safeAccumulate(const NumbersT&, NumbersT::value_type = {});
-  ForwardList< NumbersT > transpose(const ForwardList< NumbersT >&);
-  struct is_empty_list
+  class ColumnView final
   {
-    bool operator()(const NumbersT& nums) { return nums.empty(); }
+  public:
+    class ConstIterator;
+    using value_type = NumbersT::value_type;
+    using const_iterator = ConstIterator;
+
+    explicit ColumnView(const ForwardList< NumbersT >&);
+
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+    bool empty() const noexcept;
+
+    ColumnView& operator++();
+
+  private:
+    using RowCursor = std::pair< NumbersT::const_iterator, NumbersT::const_iterator >;
+    using RowCursors = ForwardList< RowCursor >;
+
+    RowCursors cursors_;
   };
 
+  class ColumnView::ConstIterator final
+  {
+  public:
+    using value_type = NumbersT::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+    using iterator_category = std::forward_iterator_tag;
+
+    ConstIterator() = default;
+
+    reference operator*() const noexcept;
+    pointer operator->() const noexcept;
+
+    ConstIterator& operator++() noexcept;
+    ConstIterator operator++(int) noexcept;
+
+    bool operator==(const ConstIterator&) const noexcept;
+    bool operator!=(const ConstIterator&) const noexcept;
+
+  private:
+    RowCursors::const_iterator cursor_;
+
+    explicit ConstIterator(RowCursors::const_iterator) noexcept;
+
+    friend class ColumnView;
+  };
+
+  NumbersT::value_type safeAccumulate(const NumbersT&, NumbersT::value_type = {});
+  NumbersT::value_type safeAccumulate(const ColumnView&, NumbersT::value_type = {});
 }
 
 #endif
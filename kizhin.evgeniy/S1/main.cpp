@@ -1,4 +1,3 @@
-#include <algorithm>
 #include <stdexcept>
 #include "io-utils.hpp"
 #include "list-utils.hpp"
@@ -12,22 +11,19 @@ int main()
     if (!inputSequences(std::cin, names, numbers)) {
       throw std::logic_error("Failed to input");
     }
-    numbers = transpose(numbers);
     outputList(std::cout, names);
     if (!names.empty()) {
       std::cout << '\n';
     }
-    if (names.empty() || std::all_of(numbers.begin(), numbers.end(), is_empty_list{})) {
+    ColumnView column(numbers);
+    if (names.empty() || column.empty()) {
       std::cout << "0\n";
       return 0;
     }
     ForwardList< NumbersT::value_type > sums;
-    for (const auto& num: numbers) {
-      outputList(std::cout, num);
-      if (!num.empty()) {
-        std::cout << '\n';
-      }
-      sums.pushBack(safeAccumulate(num));
+    for (; !column.empty(); ++column) {
+      outputList(std::cout, column) << '\n';
+      sums.pushBack(safeAccumulate(column));
     }
     outputList(std::cout, sums);
     if (!sums.empty()) {
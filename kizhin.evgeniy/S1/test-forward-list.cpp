@@ -1,3 +1,4 @@
+#include <stdexcept>
 #include <boost/test/unit_test_suite.hpp>
 #include "test-utils.hpp"
 
@@ -569,6 +570,46 @@ BOOST_AUTO_TEST_CASE(remove_if)
   BOOST_TEST(list == expected);
 }
 
+BOOST_AUTO_TEST_CASE(partition_empty)
+{
+  ListT list;
+  auto pred = [](ListT::const_reference v) -> bool
+  {
+    return v < 0;
+  };
+  const ListT::iterator pos = list.partition(pred);
+  testForwardListInvariants(list);
+  BOOST_TEST((pos == list.end()));
+}
+
+BOOST_AUTO_TEST_CASE(partition)
+{
+  ListT list{ 5, 2, 8, 1, 6, 3 };
+  const ListT expected{ 2, 1, 3, 5, 8, 6 };
+  auto pred = [](ListT::const_reference v) -> bool
+  {
+    return v < 4;
+  };
+  const ListT::iterator pos = list.partition(pred);
+  testForwardListInvariants(list);
+  BOOST_TEST(list == expected);
+  BOOST_TEST(*pos == 5);
+}
+
+BOOST_AUTO_TEST_CASE(partition_all_accepted)
+{
+  ListT list{ 1, 2, 3 };
+  const ListT copied(list);
+  auto pred = [](ListT::const_reference) -> bool
+  {
+    return true;
+  };
+  const ListT::iterator pos = list.partition(pred);
+  testForwardListInvariants(list);
+  BOOST_TEST(list == copied);
+  BOOST_TEST((pos == list.end()));
+}
+
 BOOST_AUTO_TEST_CASE(unique_empty)
 {
   ListT list;
@@ -665,6 +706,22 @@ BOOST_AUTO_TEST_CASE(merge_comparator)
   BOOST_TEST(source.empty());
 }
 
+BOOST_AUTO_TEST_CASE(merge_stable)
+{
+  ListT list{ 1.1, 2.1, 3.1 };
+  ListT source{ 1.2, 2.2, 3.2 };
+  const ListT expected{ 1.1, 1.2, 2.1, 2.2, 3.1, 3.2 };
+  auto comp = [](ListT::const_reference lhs, ListT::const_reference rhs) -> bool
+  {
+    return static_cast< int >(lhs) < static_cast< int >(rhs);
+  };
+  list.merge(source, comp);
+  testForwardListInvariants(list);
+  testForwardListInvariants(source);
+  BOOST_TEST(list == expected);
+  BOOST_TEST(source.empty());
+}
+
 BOOST_AUTO_TEST_CASE(sort_single_elem)
 {
   ListT list{ 3 };
@@ -692,6 +749,53 @@ BOOST_AUTO_TEST_CASE(sort_comparator)
   BOOST_TEST(list == expected);
 }
 
+BOOST_AUTO_TEST_CASE(sort_stable)
+{
+  ListT list{ 3.1, 1.1, 2.1, 3.2, 1.2, 2.2, 1.3 };
+  const ListT expected{ 1.1, 1.2, 1.3, 2.1, 2.2, 3.1, 3.2 };
+  auto comp = [](ListT::const_reference lhs, ListT::const_reference rhs) -> bool
+  {
+    return static_cast< int >(lhs) < static_cast< int >(rhs);
+  };
+  list.sort(comp);
+  testForwardListInvariants(list);
+  BOOST_TEST(list == expected);
+}
+
+BOOST_AUTO_TEST_CASE(sort_large)
+{
+  ListT list;
+  for (int i = 0; i != 1000; ++i) {
+    list.pushBack((i * 7919) % 1000);
+  }
+  list.sort();
+  testForwardListInvariants(list);
+  BOOST_TEST(list.size() == 1000);
+  double expected = 0;
+  for (ListT::const_iterator i = list.begin(); i != list.end(); ++i, ++expected) {
+    BOOST_TEST(*i == expected);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(sort_throwing_comparator)
+{
+  ListT list{ 3, 5, 7, 6, 8, 2, 1, 4 };
+  std::size_t calls = 0;
+  auto comp = [&calls](ListT::const_reference lhs, ListT::const_reference rhs) -> bool
+  {
+    if (++calls == 5) {
+      throw std::logic_error("comparator failure");
+    }
+    return lhs < rhs;
+  };
+  BOOST_CHECK_THROW(list.sort(comp), std::logic_error);
+  testForwardListInvariants(list);
+  BOOST_TEST(list.size() == 8);
+  list.sort();
+  const ListT expected{ 1, 2, 3, 4, 5, 6, 7, 8 };
+  BOOST_TEST(list == expected);
+}
+
 BOOST_AUTO_TEST_SUITE_END();
 BOOST_AUTO_TEST_SUITE(comparison_operators);
 
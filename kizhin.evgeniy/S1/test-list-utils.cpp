@@ -0,0 +1,42 @@
+#include <limits>
+#include <stdexcept>
+#include <boost/test/unit_test.hpp>
+#include "list-utils.hpp"
+
+using kizhin::ColumnView;
+using kizhin::NumbersT;
+
+BOOST_AUTO_TEST_SUITE(column_view);
+
+BOOST_AUTO_TEST_CASE(ragged_rows)
+{
+  const kizhin::ForwardList< NumbersT > rows = { { 1, 2, 3 }, {}, { 4 }, { 5, 6 } };
+  ColumnView column(rows);
+  const kizhin::ForwardList< NumbersT > expected = { { 1, 4, 5 }, { 2, 6 }, { 3 } };
+  for (const auto& nums: expected) {
+    BOOST_REQUIRE(!column.empty());
+    BOOST_TEST(NumbersT(column.begin(), column.end()) == nums);
+    BOOST_TEST(kizhin::safeAccumulate(column) == kizhin::safeAccumulate(nums));
+    ++column;
+  }
+  BOOST_TEST(column.empty());
+  BOOST_TEST((column.begin() == column.end()));
+}
+
+BOOST_AUTO_TEST_CASE(no_numbers)
+{
+  const kizhin::ForwardList< NumbersT > rows = { {}, {} };
+  const ColumnView column(rows);
+  BOOST_TEST(column.empty());
+}
+
+BOOST_AUTO_TEST_CASE(overflow)
+{
+  constexpr auto limit = std::numeric_limits< NumbersT::value_type >::max();
+  const kizhin::ForwardList< NumbersT > rows = { { limit }, { 1 } };
+  const ColumnView column(rows);
+  BOOST_CHECK_THROW(kizhin::safeAccumulate(column), std::overflow_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
+
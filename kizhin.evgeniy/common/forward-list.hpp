@@ -5,6 +5,7 @@
 #include <initializer_list>
 #include <memory>
 #include <utility>
+#include "internal/forward-list-algorithms.hpp"
 #include "internal/forward-list-comparison.hpp"
 #include "internal/forward-list-iterator.hpp"
 #include "internal/forward-list-swap.hpp"
@@ -87,6 +88,8 @@ namespace kizhin {
     void remove(const_reference);
     template < typename UnaryPredicate >
     void removeIf(UnaryPredicate);
+    template < typename UnaryPredicate >
+    iterator partition(UnaryPredicate);
 
     void unique();
     template < typename BinaryPredicate >
@@ -102,10 +105,14 @@ namespace kizhin {
 
   private:
     using Node = detail::Node< value_type >;
+    using NodeChain = detail::NodeChain< value_type >;
 
     Node* beforeBegin_;
     Node* end_;
     size_type size_;
+
+    NodeChain nodes() const noexcept;
+    void relink(NodeChain, NodeChain) noexcept;
   };
 
   template < typename T >
@@ -542,16 +549,36 @@ namespace kizhin {
   template < typename UnaryPredicate >
   void ForwardList< T >::removeIf(UnaryPredicate p)
   {
-    const_iterator curr = begin();
-    const_iterator prev = beforeBegin();
-    while (curr != end()) {
-      if (p(*curr)) {
-        curr = eraseAfter(prev);
-      } else {
-        prev = curr;
-        ++curr;
-      }
+    NodeChain kept = nodes();
+    size_type erased = 0;
+    try {
+      detail::eraseChainIf(kept, erased, p);
+    } catch (...) {
+      size_ -= erased;
+      relink(kept, NodeChain{});
+      throw;
     }
+    size_ -= erased;
+    relink(kept, NodeChain{});
+  }
+
+  template < typename T >
+  template < typename UnaryPredicate >
+  typename ForwardList< T >::iterator ForwardList< T >::partition(UnaryPredicate p)
+  {
+    NodeChain accepted = nodes();
+    NodeChain rejected;
+    try {
+      detail::partitionChain(accepted, rejected, p);
+    } catch (...) {
+      detail::appendChain(accepted, rejected);
+      relink(accepted, NodeChain{});
+      throw;
+    }
+    Node* firstRejected = rejected.head;
+    detail::appendChain(accepted, rejected);
+    relink(accepted, NodeChain{});
+    return iterator(firstRejected);
   }
 
   template < typename T >
@@ -564,21 +591,15 @@ namespace kizhin {
   template < typename BinaryPredicate >
   void ForwardList< T >::unique(BinaryPredicate p)
   {
-    if (empty()) {
-      return;
+    NodeChain kept = nodes();
+    NodeChain duplicates;
+    try {
+      detail::uniqueChain(kept, duplicates, p);
+    } catch (...) {
+      relink(kept, duplicates);
+      throw;
     }
-    Node* curr = beforeBegin_->next;
-    while (curr->next != nullptr) {
-      if (p(curr->data, curr->next->data)) {
-        Node* tmp = curr->next;
-        curr->next = tmp->next;
-        delete tmp;
-        --size_;
-      } else {
-        curr = curr->next;
-      }
-    }
-    end_ = curr;
+    relink(kept, duplicates);
   }
 
   template < typename T >
@@ -594,26 +615,18 @@ namespace kizhin {
     if (this == std::addressof(source) || source.empty()) {
       return;
     }
-    if (empty()) {
-      swap(source);
-      return;
+    NodeChain merged = nodes();
+    NodeChain sourceNodes = source.nodes();
+    size_ += std::exchange(source.size_, 0);
+    source.beforeBegin_->next = nullptr;
+    source.end_ = source.beforeBegin_;
+    try {
+      merged = detail::mergeChains(merged, sourceNodes, comp);
+    } catch (...) {
+      relink(merged, NodeChain{});
+      throw;
     }
-    iterator thisCurr = begin();
-    iterator sourceCurr = source.begin();
-    ForwardList result;
-    while (thisCurr != end() && sourceCurr != source.end()) {
-      if (comp(*thisCurr, *sourceCurr)) {
-        result.emplaceBack(*thisCurr);
-        ++thisCurr;
-      } else {
-        result.emplaceBack(*sourceCurr);
-        ++sourceCurr;
-      }
-    }
-    result.insertAfter(const_iterator(result.end_), thisCurr, end());
-    result.insertAfter(const_iterator(result.end_), sourceCurr, source.end());
-    source.clear();
-    swap(result);
+    relink(merged, NodeChain{});
   }
 
   template < typename T >
@@ -629,16 +642,28 @@ namespace kizhin {
     if (size_ <= 1) {
       return;
     }
-    const iterator mid = std::next(begin(), size_ / 2);
-    ForwardList< T > left;
-    ForwardList< T > right;
-    left.spliceAfter(left.beforeBegin(), *this, beforeBegin(), mid);
-    right.spliceAfter(right.beforeBegin(), *this, beforeBegin(), end());
-
-    left.sort(comp);
-    right.sort(comp);
-    merge(left, comp);
-    merge(right, comp);
+    NodeChain sorted = nodes();
+    try {
+      detail::sortChain(sorted, comp);
+    } catch (...) {
+      relink(sorted, NodeChain{});
+      throw;
+    }
+    relink(sorted, NodeChain{});
+  }
+
+  template < typename T >
+  typename ForwardList< T >::NodeChain ForwardList< T >::nodes() const noexcept
+  {
+    return empty() ? NodeChain{} : NodeChain{ beforeBegin_->next, end_ };
+  }
+
+  template < typename T >
+  void ForwardList< T >::relink(NodeChain kept, NodeChain dropped) noexcept
+  {
+    beforeBegin_->next = kept.head;
+    end_ = kept.head ? kept.tail : beforeBegin_;
+    size_ -= detail::destroyChain(dropped.head);
   }
 }
 
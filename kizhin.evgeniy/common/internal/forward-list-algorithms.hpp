@@ -0,0 +1,194 @@
+#ifndef SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_INTERNAL_FORWARD_LIST_ALGORITHMS_HPP
+#define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_INTERNAL_FORWARD_LIST_ALGORITHMS_HPP
+
+#include <cstddef>
+#include "forward-list-node.hpp"
+
+namespace kizhin {
+  namespace detail {
+    template < typename T >
+    struct NodeChain final
+    {
+      Node< T >* head = nullptr;
+      Node< T >* tail = nullptr;
+    };
+
+    template < typename T >
+    void appendNode(NodeChain< T >& chain, Node< T >* node) noexcept
+    {
+      if (chain.head) {
+        chain.tail->next = node;
+      } else {
+        chain.head = node;
+      }
+      chain.tail = node;
+    }
+
+    template < typename T >
+    void appendChain(NodeChain< T >& chain, const NodeChain< T >& rhs) noexcept
+    {
+      if (!rhs.head) {
+        return;
+      }
+      if (chain.head) {
+        chain.tail->next = rhs.head;
+      } else {
+        chain.head = rhs.head;
+      }
+      chain.tail = rhs.tail;
+    }
+
+    template < typename T >
+    void terminateChain(NodeChain< T >& chain) noexcept
+    {
+      if (chain.head) {
+        chain.tail->next = nullptr;
+      }
+    }
+
+    template < typename T >
+    std::size_t destroyChain(Node< T >* head) noexcept
+    {
+      std::size_t count = 0;
+      while (head) {
+        Node< T >* next = head->next;
+        delete head;
+        head = next;
+        ++count;
+      }
+      return count;
+    }
+
+    template < typename T, typename Comparator >
+    NodeChain< T > mergeChains(NodeChain< T >& lhs, NodeChain< T >& rhs, Comparator& comp)
+    {
+      NodeChain< T > result;
+      try {
+        while (lhs.head && rhs.head) {
+          NodeChain< T >& from = comp(rhs.head->data, lhs.head->data) ? rhs : lhs;
+          Node< T >* node = from.head;
+          from.head = node->next;
+          appendNode(result, node);
+        }
+      } catch (...) {
+        appendChain(result, lhs);
+        appendChain(result, rhs);
+        lhs = result;
+        rhs = NodeChain< T >{};
+        throw;
+      }
+      appendChain(result, lhs);
+      appendChain(result, rhs);
+      lhs = NodeChain< T >{};
+      rhs = NodeChain< T >{};
+      return result;
+    }
+
+    template < typename T, typename Comparator >
+    void sortChain(NodeChain< T >& chain, Comparator& comp)
+    {
+      constexpr std::size_t binCount = 64;
+      NodeChain< T > bins[binCount];
+      NodeChain< T > carry;
+      Node< T >* rest = chain.head;
+      try {
+        while (rest) {
+          carry = NodeChain< T >{ rest, rest };
+          rest = rest->next;
+          carry.tail->next = nullptr;
+          std::size_t i = 0;
+          for (; (i + 1 != binCount) && bins[i].head; ++i) {
+            carry = mergeChains(bins[i], carry, comp);
+          }
+          bins[i] = mergeChains(bins[i], carry, comp);
+        }
+        for (std::size_t i = 0; i != binCount; ++i) {
+          carry = mergeChains(bins[i], carry, comp);
+        }
+      } catch (...) {
+        NodeChain< T > all;
+        for (std::size_t i = 0; i != binCount; ++i) {
+          appendChain(all, bins[i]);
+        }
+        appendChain(all, carry);
+        appendChain(all, NodeChain< T >{ rest, chain.tail });
+        terminateChain(all);
+        chain = all;
+        throw;
+      }
+      chain = carry;
+    }
+
+    template < typename T, typename UnaryPredicate >
+    void partitionChain(NodeChain< T >& chain, NodeChain< T >& rejected, UnaryPredicate& p)
+    {
+      NodeChain< T > accepted;
+      Node< T >* node = chain.head;
+      try {
+        for (; node; node = node->next) {
+          appendNode(p(node->data) ? accepted : rejected, node);
+        }
+      } catch (...) {
+        appendChain(accepted, NodeChain< T >{ node, chain.tail });
+        terminateChain(rejected);
+        chain = accepted;
+        throw;
+      }
+      terminateChain(accepted);
+      terminateChain(rejected);
+      chain = accepted;
+    }
+
+    template < typename T, typename UnaryPredicate >
+    void eraseChainIf(NodeChain< T >& chain, std::size_t& erased, UnaryPredicate& p)
+    {
+      NodeChain< T > kept;
+      Node< T >* node = chain.head;
+      try {
+        while (node) {
+          Node< T >* next = node->next;
+          if (p(node->data)) {
+            delete node;
+            ++erased;
+          } else {
+            appendNode(kept, node);
+          }
+          node = next;
+        }
+      } catch (...) {
+        appendChain(kept, NodeChain< T >{ node, chain.tail });
+        chain = kept;
+        throw;
+      }
+      terminateChain(kept);
+      chain = kept;
+    }
+
+    template < typename T, typename BinaryPredicate >
+    void uniqueChain(NodeChain< T >& chain, NodeChain< T >& duplicates, BinaryPredicate& p)
+    {
+      NodeChain< T > kept;
+      Node< T >* node = chain.head;
+      try {
+        for (; node; node = node->next) {
+          if (kept.head && p(kept.tail->data, node->data)) {
+            appendNode(duplicates, node);
+          } else {
+            appendNode(kept, node);
+          }
+        }
+      } catch (...) {
+        appendChain(kept, NodeChain< T >{ node, chain.tail });
+        terminateChain(duplicates);
+        chain = kept;
+        throw;
+      }
+      terminateChain(kept);
+      terminateChain(duplicates);
+      chain = kept;
+    }
+  }
+}
+
+#endif
+
@@ -171,6 +171,7 @@ namespace kizhin {
     std::tuple< Node*, Node* > splitInTwo(const Node*);
     void splitChildren(const Node* src, Node* left, Node* right) const noexcept;
 
+    std::size_t lowerIndex(const Node*, const key_type&) const;
     pointer findKey(const Node*, const key_type&) const;
     Node* findTarget(Node*, const key_type&) const;
     Node* validateHint(Node*, const key_type&) const;
@@ -1300,21 +1301,27 @@ void kizhin::Map< K, T, C >::splitChildren(const Node* src, Node* left,
   std::copy(mid, src->children.end(), right->children.begin());
 }
 
+template < typename K, typename T, typename C >
+std::size_t kizhin::Map< K, T, C >::lowerIndex(const Node* node, const key_type& key) const
+{
+  assert(node && "LowerIndex: nullptr node given");
+  const_pointer position = node->begin;
+  while (position != node->end && comparator_(position->first, key)) {
+    ++position;
+  }
+  return position - node->begin;
+}
+
 template < typename K, typename T, typename C >
 typename kizhin::Map< K, T, C >::pointer kizhin::Map< K, T, C >::findKey(const Node* node,
     const key_type& key) const
 {
   assert(node && "FindKey: nullptr node given");
-  struct KeyEqual
-  {
-    bool operator()(const_reference val) const
-    {
-      return !comp(val.first, key) && !comp(key, val.first);
-    }
-    C comp;
-    const key_type& key;
-  };
-  return std::find_if(node->begin, node->end, KeyEqual{ keyComp(), key });
+  pointer position = node->begin + lowerIndex(node, key);
+  if (position != node->end && !comparator_(key, position->first)) {
+    return position;
+  }
+  return node->end;
 }
 
 template < typename K, typename T, typename C >
@@ -1323,15 +1330,13 @@ typename kizhin::Map< K, T, C >::Node* kizhin::Map< K, T, C >::findTarget(Node*
 {
   assert(!empty() && "Attempt to find target node in empty tree");
   Node* current = validateHint(hint, key);
-  while (!detail::isLeaf(current) && findKey(current, key) == current->end) {
-    const size_t currSize = detail::size(current);
-    if (comparator_(key, current->begin->first)) {
-      current = current->children[0];
-    } else if (currSize == 1 || comparator_(key, (current->begin + 1)->first)) {
-      current = current->children[1];
-    } else {
-      current = current->children[2];
+  while (!detail::isLeaf(current)) {
+    const std::size_t index = lowerIndex(current, key);
+    const pointer position = current->begin + index;
+    if (position != current->end && !comparator_(key, position->first)) {
+      break;
     }
+    current = current->children[index];
   }
   return current;
 }
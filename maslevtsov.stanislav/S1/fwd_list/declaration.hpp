@@ -5,6 +5,7 @@
 #include <initializer_list>
 #include "fwd_list_node.hpp"
 #include "fwd_iterator.hpp"
+#include "node_chain.hpp"
 
 namespace maslevtsov {
   template< class T >
@@ -70,11 +71,30 @@ namespace maslevtsov {
     void remove(const T& value) noexcept;
     template< class UnaryPredicate >
     void remove_if(UnaryPredicate condition);
+    template< class UnaryPredicate >
+    std::size_t partition(UnaryPredicate condition);
+    void unique();
+    template< class BinaryPredicate >
+    void unique(BinaryPredicate condition);
+    void merge(FwdList& other);
+    void merge(FwdList&& other);
+    template< class Compare >
+    void merge(FwdList& other, Compare comp);
+    template< class Compare >
+    void merge(FwdList&& other, Compare comp);
+    void sort();
+    template< class Compare >
+    void sort(Compare comp);
 
   private:
+    using node_chain_t = detail::NodeChain< T >;
+
     FwdListNode< T >* tail_;
     std::size_t size_;
 
+    node_chain_t unlink_nodes() noexcept;
+    void relink(node_chain_t kept, node_chain_t dropped) noexcept;
+
     template< class InputIt >
     void copy(InputIt first, InputIt last);
     void emplace_front(FwdListNode< T >* node) noexcept;
@@ -2,6 +2,7 @@
 #define FWD_LIST_DEFINITION_HPP
 
 #include "declaration.hpp"
+#include <functional>
 #include <utility>
 
 template< class T >
@@ -400,6 +401,129 @@ void maslevtsov::FwdList< T >::remove_if(UnaryPredicate condition)
   }
 }
 
+template< class T >
+template< class UnaryPredicate >
+std::size_t maslevtsov::FwdList< T >::partition(UnaryPredicate condition)
+{
+  node_chain_t accepted = unlink_nodes();
+  node_chain_t rejected;
+  std::size_t accepted_count = 0;
+  try {
+    accepted_count = detail::partition_chain(accepted, rejected, condition);
+  } catch (...) {
+    detail::append_chain(accepted, rejected);
+    relink(accepted, node_chain_t{});
+    throw;
+  }
+  detail::append_chain(accepted, rejected);
+  relink(accepted, node_chain_t{});
+  return accepted_count;
+}
+
+template< class T >
+void maslevtsov::FwdList< T >::unique()
+{
+  unique(std::equal_to< T >());
+}
+
+template< class T >
+template< class BinaryPredicate >
+void maslevtsov::FwdList< T >::unique(BinaryPredicate condition)
+{
+  node_chain_t kept = unlink_nodes();
+  node_chain_t duplicates;
+  try {
+    detail::unique_chain(kept, duplicates, condition);
+  } catch (...) {
+    relink(kept, duplicates);
+    throw;
+  }
+  relink(kept, duplicates);
+}
+
+template< class T >
+void maslevtsov::FwdList< T >::merge(FwdList& other)
+{
+  merge(other, std::less< T >());
+}
+
+template< class T >
+void maslevtsov::FwdList< T >::merge(FwdList&& other)
+{
+  merge(other);
+}
+
+template< class T >
+template< class Compare >
+void maslevtsov::FwdList< T >::merge(FwdList& other, Compare comp)
+{
+  if (this == std::addressof(other) || other.empty()) {
+    return;
+  }
+  node_chain_t merged = unlink_nodes();
+  node_chain_t other_nodes = other.unlink_nodes();
+  size_ += std::exchange(other.size_, 0);
+  other.tail_ = nullptr;
+  try {
+    merged = detail::merge_chains(merged, other_nodes, comp);
+  } catch (...) {
+    relink(merged, node_chain_t{});
+    throw;
+  }
+  relink(merged, node_chain_t{});
+}
+
+template< class T >
+template< class Compare >
+void maslevtsov::FwdList< T >::merge(FwdList&& other, Compare comp)
+{
+  merge(other, comp);
+}
+
+template< class T >
+void maslevtsov::FwdList< T >::sort()
+{
+  sort(std::less< T >());
+}
+
+template< class T >
+template< class Compare >
+void maslevtsov::FwdList< T >::sort(Compare comp)
+{
+  if (size_ <= 1) {
+    return;
+  }
+  node_chain_t sorted = unlink_nodes();
+  try {
+    detail::sort_chain(sorted, comp);
+  } catch (...) {
+    relink(sorted, node_chain_t{});
+    throw;
+  }
+  relink(sorted, node_chain_t{});
+}
+
+template< class T >
+typename maslevtsov::FwdList< T >::node_chain_t maslevtsov::FwdList< T >::unlink_nodes() noexcept
+{
+  if (empty()) {
+    return node_chain_t{};
+  }
+  node_chain_t chain{tail_->next_, tail_};
+  tail_->next_ = nullptr;
+  return chain;
+}
+
+template< class T >
+void maslevtsov::FwdList< T >::relink(node_chain_t kept, node_chain_t dropped) noexcept
+{
+  tail_ = kept.tail_;
+  if (tail_) {
+    tail_->next_ = kept.head_;
+  }
+  size_ -= detail::destroy_chain(dropped.head_);
+}
+
 template< class T >
 template< class InputIt >
 void maslevtsov::FwdList< T >::copy(InputIt first, InputIt last)
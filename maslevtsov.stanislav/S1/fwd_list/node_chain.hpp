@@ -0,0 +1,185 @@
+#ifndef FWD_LIST_NODE_CHAIN_HPP
+#define FWD_LIST_NODE_CHAIN_HPP
+
+#include <cstddef>
+#include <memory>
+#include "fwd_list_node.hpp"
+
+namespace maslevtsov {
+  namespace detail {
+    template< class T >
+    struct NodeChain
+    {
+      FwdListNode< T >* head_ = nullptr;
+      FwdListNode< T >* tail_ = nullptr;
+    };
+
+    template< class T >
+    void append_node(NodeChain< T >& chain, FwdListNode< T >* node) noexcept
+    {
+      if (chain.head_) {
+        chain.tail_->next_ = node;
+      } else {
+        chain.head_ = node;
+      }
+      chain.tail_ = node;
+    }
+
+    template< class T >
+    void append_chain(NodeChain< T >& chain, const NodeChain< T >& rhs) noexcept
+    {
+      if (!rhs.head_) {
+        return;
+      }
+      if (chain.head_) {
+        chain.tail_->next_ = rhs.head_;
+      } else {
+        chain.head_ = rhs.head_;
+      }
+      chain.tail_ = rhs.tail_;
+    }
+
+    template< class T >
+    void terminate_chain(NodeChain< T >& chain) noexcept
+    {
+      if (chain.head_) {
+        chain.tail_->next_ = nullptr;
+      }
+    }
+
+    template< class T >
+    std::size_t destroy_chain(FwdListNode< T >* head) noexcept
+    {
+      std::size_t count = 0;
+      while (head) {
+        FwdListNode< T >* next = head->next_;
+        delete head;
+        head = next;
+        ++count;
+      }
+      return count;
+    }
+
+    template< class T, class Compare >
+    NodeChain< T > merge_chains(NodeChain< T >& lhs, NodeChain< T >& rhs, Compare& comp)
+    {
+      if (!lhs.head_ || !rhs.head_) {
+        NodeChain< T > result = lhs.head_ ? lhs : rhs;
+        lhs = NodeChain< T >{};
+        rhs = NodeChain< T >{};
+        return result;
+      }
+      FwdListNode< T >* head = nullptr;
+      FwdListNode< T >** link = std::addressof(head);
+      FwdListNode< T >* left = lhs.head_;
+      FwdListNode< T >* right = rhs.head_;
+      try {
+        while (left && right) {
+          FwdListNode< T >*& from = comp(right->data_, left->data_) ? right : left;
+          *link = from;
+          link = std::addressof(from->next_);
+          from = from->next_;
+        }
+      } catch (...) {
+        *link = left;
+        lhs.tail_->next_ = right;
+        lhs = NodeChain< T >{head, rhs.tail_};
+        rhs = NodeChain< T >{};
+        throw;
+      }
+      NodeChain< T > result{head, left ? lhs.tail_ : rhs.tail_};
+      *link = left ? left : right;
+      lhs = NodeChain< T >{};
+      rhs = NodeChain< T >{};
+      return result;
+    }
+
+    template< class T, class Compare >
+    void sort_chain(NodeChain< T >& chain, Compare& comp)
+    {
+      constexpr std::size_t bins_count = 64;
+      NodeChain< T > bins[bins_count];
+      NodeChain< T > carry;
+      FwdListNode< T >* rest = chain.head_;
+      try {
+        while (rest) {
+          carry = NodeChain< T >{rest, rest};
+          rest = rest->next_;
+          carry.tail_->next_ = nullptr;
+          std::size_t i = 0;
+          for (; (i + 1 != bins_count) && bins[i].head_; ++i) {
+            carry = merge_chains(bins[i], carry, comp);
+          }
+          bins[i] = merge_chains(bins[i], carry, comp);
+        }
+        for (std::size_t i = 0; i != bins_count; ++i) {
+          carry = merge_chains(bins[i], carry, comp);
+        }
+      } catch (...) {
+        NodeChain< T > all;
+        for (std::size_t i = 0; i != bins_count; ++i) {
+          append_chain(all, bins[i]);
+        }
+        append_chain(all, carry);
+        append_chain(all, NodeChain< T >{rest, chain.tail_});
+        terminate_chain(all);
+        chain = all;
+        throw;
+      }
+      chain = carry;
+    }
+
+    template< class T, class UnaryPredicate >
+    std::size_t partition_chain(NodeChain< T >& chain, NodeChain< T >& rejected, UnaryPredicate& condition)
+    {
+      NodeChain< T > accepted;
+      std::size_t accepted_count = 0;
+      FwdListNode< T >* node = chain.head_;
+      try {
+        for (; node; node = node->next_) {
+          if (condition(node->data_)) {
+            append_node(accepted, node);
+            ++accepted_count;
+          } else {
+            append_node(rejected, node);
+          }
+        }
+      } catch (...) {
+        append_chain(accepted, NodeChain< T >{node, chain.tail_});
+        terminate_chain(rejected);
+        chain = accepted;
+        throw;
+      }
+      terminate_chain(accepted);
+      terminate_chain(rejected);
+      chain = accepted;
+      return accepted_count;
+    }
+
+    template< class T, class BinaryPredicate >
+    void unique_chain(NodeChain< T >& chain, NodeChain< T >& duplicates, BinaryPredicate& condition)
+    {
+      NodeChain< T > kept;
+      FwdListNode< T >* node = chain.head_;
+      try {
+        for (; node; node = node->next_) {
+          if (kept.head_ && condition(kept.tail_->data_, node->data_)) {
+            append_node(duplicates, node);
+          } else {
+            append_node(kept, node);
+          }
+        }
+      } catch (...) {
+        append_chain(kept, NodeChain< T >{node, chain.tail_});
+        terminate_chain(duplicates);
+        chain = kept;
+        throw;
+      }
+      terminate_chain(kept);
+      terminate_chain(duplicates);
+      chain = kept;
+    }
+  }
+}
+
+#endif
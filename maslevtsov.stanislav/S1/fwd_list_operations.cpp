@@ -1,16 +1,22 @@
 #include "fwd_list_operations.hpp"
 #include <limits>
 #include <ostream>
+#include <stdexcept>
+#include <utility>
 #include "fwd_list/definition.hpp"
 
 namespace {
-  unsigned long long checked_sum(unsigned long long a, unsigned long long b)
+  using cursor_t = std::pair< maslevtsov::list_t::const_iterator, std::size_t >;
+  using cursors_list_t = maslevtsov::FwdList< cursor_t >;
+
+  bool add_checked(unsigned long long& sum, unsigned long long value) noexcept
   {
     const unsigned long long max_ull = std::numeric_limits< unsigned long long >::max();
-    if (max_ull - a > b) {
-      return a + b;
+    if (max_ull - sum > value) {
+      sum += value;
+      return true;
     }
-    throw std::overflow_error("overflow");
+    return false;
   }
 
   void print_list_elements(std::ostream& out, const maslevtsov::list_t& list) noexcept
@@ -23,46 +29,58 @@ namespace {
     }
   }
 
-  void get_column_elements(maslevtsov::list_t& list, const maslevtsov::pairs_list_t& pairs_list, std::size_t border)
+  void make_cursors(cursors_list_t& cursors, const maslevtsov::pairs_list_t& pairs_list)
+  {
+    auto i = pairs_list.cbegin();
+    do {
+      if (!i->second.empty()) {
+        cursors.push_back(cursor_t(i->second.cbegin(), i->second.size()));
+      }
+      ++i;
+    } while (i != pairs_list.cend());
+  }
+
+  void next_column(cursors_list_t& cursors) noexcept
   {
-    maslevtsov::list_t cur_list = pairs_list.cbegin()->second;
-    if (cur_list.size() > border) {
-      auto it = cur_list.cbegin();
-      for (std::size_t k = 0; k != border; ++k, ++it)
-      {}
-      list.push_back(*it);
+    std::size_t count = cursors.size();
+    auto it = cursors.begin();
+    for (std::size_t k = 0; k != count; ++k, ++it) {
+      ++it->first;
+      --it->second;
     }
-    for (auto j = ++pairs_list.cbegin(); j != pairs_list.cend(); ++j) {
-      maslevtsov::list_t cur_list = j->second;
-      if (cur_list.size() > border) {
-        auto it = cur_list.cbegin();
-        for (std::size_t k = 0; k != border; ++k, ++it)
-        {}
-        list.push_back(*it);
+    auto prev = cursors.cbegin();
+    for (std::size_t k = 1; k != count; ++k, ++prev)
+    {}
+    for (std::size_t k = 0; k != count; ++k) {
+      auto cur = prev;
+      ++cur;
+      if (cur->second == 0) {
+        cursors.erase_after(prev);
+      } else {
+        prev = cur;
       }
     }
   }
 
-  std::size_t get_cur_sum(const maslevtsov::pairs_list_t& pairs_list, std::size_t border)
+  void print_column(std::ostream& out, const cursors_list_t& cursors)
   {
-    std::size_t result = 0;
-    maslevtsov::list_t cur_list = pairs_list.cbegin()->second;
-    if (cur_list.size() > border) {
-      auto it = cur_list.cbegin();
-      for (std::size_t k = 0; k != border; ++k, ++it)
-      {}
-      result = checked_sum(result, *it);
+    out << *cursors.cbegin()->first;
+    for (auto j = ++cursors.cbegin(); j != cursors.cend(); ++j) {
+      out << ' ' << *j->first;
     }
-    for (auto j = ++pairs_list.cbegin(); j != pairs_list.cend(); ++j) {
-      maslevtsov::list_t cur_list = j->second;
-      if (cur_list.size() > border) {
-        auto it = cur_list.cbegin();
-        for (std::size_t k = 0; k != border; ++k, ++it)
-        {}
-        result = checked_sum(result, *it);
+  }
+
+  bool get_column_sum(unsigned long long& sum, const cursors_list_t& cursors) noexcept
+  {
+    sum = 0;
+    auto j = cursors.cbegin();
+    do {
+      if (!add_checked(sum, *j->first)) {
+        return false;
       }
-    }
-    return result;
+      ++j;
+    } while (j != cursors.cend());
+    return true;
   }
 }
 
@@ -77,26 +95,37 @@ std::size_t maslevtsov::get_max_pairs_list_size(const pairs_list_t& list) noexce
 
 void maslevtsov::get_lists_sums(list_t& sums, const pairs_list_t& pairs_list)
 {
-  std::size_t max_pairs_list_size = get_max_pairs_list_size(pairs_list);
-  for (std::size_t i = 0; i != max_pairs_list_size; ++i) {
-    std::size_t cur_sum = get_cur_sum(pairs_list, i);
+  cursors_list_t cursors;
+  make_cursors(cursors, pairs_list);
+  while (!cursors.empty()) {
+    unsigned long long cur_sum = 0;
+    if (!get_column_sum(cur_sum, cursors)) {
+      throw std::overflow_error("overflow");
+    }
     sums.push_back(cur_sum);
+    next_column(cursors);
   }
 }
 
 void maslevtsov::print_lists_info(std::ostream& out, const pairs_list_t& pairs_list)
 {
-  std::size_t max_pairs_list_size = get_max_pairs_list_size(pairs_list);
-  for (std::size_t i = 0; i != max_pairs_list_size; ++i) {
-    list_t column_elements;
-    get_column_elements(column_elements, pairs_list, i);
-    if (!column_elements.empty()) {
-      print_list_elements(out, column_elements);
-      out << '\n';
+  list_t sums;
+  bool is_overflow = false;
+  cursors_list_t cursors;
+  make_cursors(cursors, pairs_list);
+  while (!cursors.empty()) {
+    print_column(out, cursors);
+    out << '\n';
+    unsigned long long cur_sum = 0;
+    is_overflow = is_overflow || !get_column_sum(cur_sum, cursors);
+    if (!is_overflow) {
+      sums.push_back(cur_sum);
     }
+    next_column(cursors);
+  }
+  if (is_overflow) {
+    throw std::overflow_error("overflow");
   }
-  list_t sums;
-  get_lists_sums(sums, pairs_list);
   if (sums.empty()) {
     out << 0;
     return;
@@ -1,4 +1,5 @@
 #include <boost/test/unit_test.hpp>
+#include <stdexcept>
 #include "fwd_list/definition.hpp"
 
 namespace {
@@ -322,4 +323,115 @@ BOOST_AUTO_TEST_CASE(remove_if_test)
   });
   compare_list_values(list, {1, 3, 5});
 }
+
+BOOST_AUTO_TEST_CASE(partition_test)
+{
+  maslevtsov::FwdList< int > list = {5, 2, 8, 1, 6, 3};
+  std::size_t accepted = list.partition([](const int& list_value)
+  {
+    return list_value < 4;
+  });
+  BOOST_TEST(accepted == 3);
+  compare_list_values(list, {2, 1, 3, 5, 8, 6});
+  BOOST_TEST(list.back() == 6);
+
+  accepted = list.partition([](const int&)
+  {
+    return false;
+  });
+  BOOST_TEST(accepted == 0);
+  compare_list_values(list, {2, 1, 3, 5, 8, 6});
+
+  maslevtsov::FwdList< int > empty_list;
+  BOOST_TEST(empty_list.partition([](const int&)
+  {
+    return true;
+  }) == 0);
+  BOOST_TEST(empty_list.empty());
+}
+
+BOOST_AUTO_TEST_CASE(unique_test)
+{
+  maslevtsov::FwdList< int > list = {1, 1, 2, 2, 2, 3, 1, 1};
+  list.unique();
+  compare_list_values(list, {1, 2, 3, 1});
+  BOOST_TEST(list.back() == 1);
+  list.push_back(4);
+  compare_list_values(list, {1, 2, 3, 1, 4});
+
+  list = {1, 2, 4, 5, 7, 8};
+  list.unique([](const int& lhs, const int& rhs)
+  {
+    return rhs - lhs == 1;
+  });
+  compare_list_values(list, {1, 4, 7});
+}
+
+BOOST_AUTO_TEST_CASE(merge_test)
+{
+  maslevtsov::FwdList< int > list1 = {1, 3, 5};
+  maslevtsov::FwdList< int > list2 = {0, 2, 4, 6, 8};
+  list1.merge(list2);
+  compare_list_values(list1, {0, 1, 2, 3, 4, 5, 6, 8});
+  BOOST_TEST(list2.empty());
+  BOOST_TEST(list1.back() == 8);
+  list1.merge(list1);
+  BOOST_TEST(list1.size() == 8);
+
+  maslevtsov::FwdList< int > empty_list;
+  empty_list.merge(list1);
+  compare_list_values(empty_list, {0, 1, 2, 3, 4, 5, 6, 8});
+  BOOST_TEST(list1.empty());
+
+  maslevtsov::FwdList< double > list3 = {1.1, 2.1, 3.1};
+  list3.merge(maslevtsov::FwdList< double >{1.2, 2.2, 3.2}, [](const double& lhs, const double& rhs)
+  {
+    return static_cast< int >(lhs) < static_cast< int >(rhs);
+  });
+  compare_list_values(list3, {1.1, 1.2, 2.1, 2.2, 3.1, 3.2});
+}
+
+BOOST_AUTO_TEST_CASE(sort_test)
+{
+  maslevtsov::FwdList< int > list = {5, 2, 8, 1, 6, 3, 7, 4};
+  list.sort();
+  compare_list_values(list, {1, 2, 3, 4, 5, 6, 7, 8});
+  BOOST_TEST(list.back() == 8);
+  list.sort([](const int& lhs, const int& rhs)
+  {
+    return lhs > rhs;
+  });
+  compare_list_values(list, {8, 7, 6, 5, 4, 3, 2, 1});
+
+  maslevtsov::FwdList< double > doubles = {3.1, 1.1, 2.1, 3.2, 1.2, 2.2, 1.3};
+  doubles.sort([](const double& lhs, const double& rhs)
+  {
+    return static_cast< int >(lhs) < static_cast< int >(rhs);
+  });
+  compare_list_values(doubles, {1.1, 1.2, 1.3, 2.1, 2.2, 3.1, 3.2});
+}
+
+BOOST_AUTO_TEST_CASE(sort_throwing_comparator_test)
+{
+  maslevtsov::FwdList< int > list = {5, 2, 8, 1, 6, 3, 7, 4};
+  std::size_t calls = 0;
+  BOOST_CHECK_THROW(list.sort([&calls](const int& lhs, const int& rhs)
+  {
+    if (++calls == 6) {
+      throw std::runtime_error("comparator failure");
+    }
+    return lhs < rhs;
+  }), std::runtime_error);
+  BOOST_TEST(list.size() == 8);
+  int sum = 0;
+  std::size_t count = 0;
+  auto it = list.cbegin();
+  do {
+    sum += *it;
+    ++count;
+    ++it;
+  } while (it != list.cend());
+  BOOST_TEST(count == 8);
+  BOOST_TEST(sum == 36);
+}
 BOOST_AUTO_TEST_SUITE_END()
@@ -5,6 +5,7 @@
 #include <cstddef>
 #include <memory>
 #include <cassert>
+#include <utility>
 
 namespace petrov
 {
@@ -102,6 +103,14 @@ namespace petrov
     size_t size() const noexcept;
     template< typename U >
     void push_front (U && val);
+    template< typename U >
+    void push_back(U && val);
+    template< typename... Args >
+    void emplace_back(Args &&... args);
+    template< typename U >
+    it_t insert_after(const_it_t pos, U && val);
+    void splice_after(const_it_t pos, this_t & rhs);
+    void splice_after(const_it_t pos, this_t && rhs);
     void pop_front();
     void remove(const T & val);
     void clear();
@@ -240,7 +249,7 @@ namespace petrov
   ForwardRingList< T >::ForwardRingList(this_t && rhs):
     head_(nullptr),
     tail_(nullptr),
-    size_(rhs.size_)
+    size_(0)
   {
     swap(rhs);
   }
@@ -394,6 +403,80 @@ namespace petrov
     }
   }
 
+  template< typename T >
+  template< typename U >
+  void ForwardRingList< T >::push_back(U && val)
+  {
+    emplace_back(std::forward< U >(val));
+  }
+
+  template< typename T >
+  template< typename... Args >
+  void ForwardRingList< T >::emplace_back(Args &&... args)
+  {
+    node_t * new_node = new node_t{ T(std::forward< Args >(args)...), nullptr };
+    if (empty())
+    {
+      new_node->next = new_node;
+      head_ = new_node;
+    }
+    else
+    {
+      new_node->next = head_;
+      tail_->next = new_node;
+    }
+    tail_ = new_node;
+    size_++;
+  }
+
+  template< typename T >
+  template< typename U >
+  typename ForwardRingList< T >::it_t ForwardRingList< T >::insert_after(const_it_t pos, U && val)
+  {
+    assert(pos.node_ != nullptr);
+    node_t * prev = const_cast< node_t * >(pos.node_);
+    if (prev == tail_)
+    {
+      emplace_back(std::forward< U >(val));
+      return it_t(tail_);
+    }
+    prev->next = new node_t{ T(std::forward< U >(val)), prev->next };
+    size_++;
+    return it_t(prev->next);
+  }
+
+  template< typename T >
+  void ForwardRingList< T >::splice_after(const_it_t pos, this_t & rhs)
+  {
+    if (rhs.empty() || this == std::addressof(rhs))
+    {
+      return;
+    }
+    if (empty())
+    {
+      swap(rhs);
+      return;
+    }
+    assert(pos.node_ != nullptr);
+    node_t * prev = const_cast< node_t * >(pos.node_);
+    rhs.tail_->next = prev->next;
+    prev->next = rhs.head_;
+    if (prev == tail_)
+    {
+      tail_ = rhs.tail_;
+    }
+    size_ += rhs.size_;
+    rhs.head_ = nullptr;
+    rhs.tail_ = nullptr;
+    rhs.size_ = 0;
+  }
+
+  template< typename T >
+  void ForwardRingList< T >::splice_after(const_it_t pos, this_t && rhs)
+  {
+    splice_after(pos, rhs);
+  }
+
   template< typename T >
   void ForwardRingList< T >::pop_front()
   {
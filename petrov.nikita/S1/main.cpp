@@ -1,6 +1,7 @@
 #include <string>
 #include <iostream>
 #include <limits>
+#include <utility>
 #include "forward_ring_list.hpp"
 
 namespace petrov
@@ -40,7 +41,6 @@ int main()
     std::cerr << e.what() << "\n";
     return 1;
   }
-  sums.reverse();
   if (sums.empty())
   {
     std::cout << 0;
@@ -72,13 +72,10 @@ std::istream & petrov::inputValuesIntoFwdRingList(std::istream & in, list_type &
       {
         break;
       }
-      sublist.push_front(number);
+      sublist.push_back(number);
     }
-    sublist.reverse();
-    pair_of_string_and_list new_pair = { sequence_num, sublist };
-    fwd_ring_list.push_front(new_pair);
+    fwd_ring_list.emplace_back(sequence_num, std::move(sublist));
   }
-  fwd_ring_list.reverse();
   return in;
 }
 
@@ -149,7 +146,7 @@ petrov::result_list_type petrov::getListOfSequencesFromListOfSums(list_type fwd_
     }
     if (sum)
     {
-      sums.push_front(sum);
+      sums.push_back(sum);
       std::cout << "\n";
     }
   }
@@ -1,6 +1,8 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/test/execution_monitor.hpp>
 #include <sstream>
+#include <string>
+#include <utility>
 #include "forward_ring_list.hpp"
 
 BOOST_AUTO_TEST_SUITE(forward_ring_list_iterator)
@@ -160,6 +162,101 @@ BOOST_AUTO_TEST_CASE(push_front_many_elements)
 BOOST_AUTO_TEST_SUITE_END()
 
 
+BOOST_AUTO_TEST_SUITE(push_back_method)
+
+BOOST_AUTO_TEST_CASE(push_back_many_elements)
+{
+  std::ostringstream out;
+  petrov::ForwardRingList< int > fwd_list;
+  for (int i = 1; i <= 10; i++)
+  {
+    fwd_list.push_back(i);
+  }
+  for (auto it = fwd_list.begin(); it != fwd_list.end(); ++it)
+  {
+    out << *it << " ";
+  }
+  out << *fwd_list.end() << " " << *(++fwd_list.end());
+  BOOST_TEST(out.str() == "1 2 3 4 5 6 7 8 9 10 1");
+}
+
+BOOST_AUTO_TEST_CASE(emplace_back_moved_list)
+{
+  petrov::ForwardRingList< int > sublist;
+  sublist.push_back(1);
+  sublist.push_back(2);
+  petrov::ForwardRingList< std::pair< std::string, petrov::ForwardRingList< int > > > fwd_list;
+  fwd_list.emplace_back("first", std::move(sublist));
+  BOOST_TEST(sublist.empty());
+  BOOST_TEST(fwd_list.size() == 1);
+  BOOST_TEST(fwd_list.cbegin()->first == "first");
+  BOOST_TEST(fwd_list.cbegin()->second.size() == 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(insert_after_method)
+
+BOOST_AUTO_TEST_CASE(insert_after_middle_and_tail)
+{
+  std::ostringstream out;
+  petrov::ForwardRingList< int > fwd_list;
+  fwd_list.push_back(1);
+  fwd_list.push_back(3);
+  fwd_list.insert_after(fwd_list.cbegin(), 2);
+  fwd_list.insert_after(fwd_list.cend(), 4);
+  for (auto it = fwd_list.begin(); it != fwd_list.end(); ++it)
+  {
+    out << *it << " ";
+  }
+  out << *fwd_list.end();
+  BOOST_TEST(out.str() == "1 2 3 4");
+  BOOST_TEST(fwd_list.size() == 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(splice_after_method)
+
+BOOST_AUTO_TEST_CASE(splice_after_tail_and_head)
+{
+  std::ostringstream out;
+  petrov::ForwardRingList< int > fwd_list;
+  petrov::ForwardRingList< int > other;
+  fwd_list.push_back(1);
+  fwd_list.push_back(4);
+  other.push_back(5);
+  other.push_back(6);
+  fwd_list.splice_after(fwd_list.cend(), other);
+  other.push_back(2);
+  other.push_back(3);
+  fwd_list.splice_after(fwd_list.cbegin(), std::move(other));
+  BOOST_TEST(other.empty());
+  for (auto it = fwd_list.begin(); it != fwd_list.end(); ++it)
+  {
+    out << *it << " ";
+  }
+  out << *fwd_list.end() << " " << *(++fwd_list.end());
+  BOOST_TEST(out.str() == "1 2 3 4 5 6 1");
+  BOOST_TEST(fwd_list.size() == 6);
+}
+
+BOOST_AUTO_TEST_CASE(splice_after_into_empty_list)
+{
+  petrov::ForwardRingList< int > fwd_list;
+  petrov::ForwardRingList< int > other;
+  other.push_back(1);
+  fwd_list.splice_after(fwd_list.cend(), other);
+  BOOST_TEST(other.empty());
+  BOOST_TEST(fwd_list.size() == 1);
+  BOOST_TEST(*fwd_list.cbegin() == 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
 BOOST_AUTO_TEST_SUITE(reverse_method)
 
 BOOST_AUTO_TEST_CASE(reverse_empty_list)
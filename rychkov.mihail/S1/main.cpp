@@ -1,37 +1,32 @@
 #include <iostream>
 #include <string>
-#include <stdexcept>
 #include <limits>
+#include <lexer.hpp>
 #include <list.hpp>
 
 int main()
 {
   rychkov::List< std::pair< std::string, rychkov::List< size_t > > > entered;
-  std::string name;
-  while (std::cin >> name)
+  rychkov::Lexer lexer(std::cin);
+  for (rychkov::Token token = lexer.next(); token.kind != rychkov::Token::END; token = lexer.next())
   {
-    try
+    switch (token.kind)
     {
-      size_t processed = 0;
-      size_t number = std::stoull(name, &processed);
-      if (processed != name.size())
-      {
-        std::cerr << "int suffix is not supplied\n";
-        return 1;
-      }
+    case rychkov::Token::NAME:
+      entered.push_back({std::string(token.data, token.size), {}});
+      break;
+    case rychkov::Token::NUMBER:
       if (entered.empty())
       {
         std::cerr << "missing name in input\n";
         return 1;
       }
-      entered.back().second.push_back(number);
-    }
-    catch (const std::invalid_argument&)
-    {
-      entered.push_back({name, {}});
-    }
-    catch (const std::out_of_range&)
-    {
+      entered.back().second.push_back(token.number);
+      break;
+    case rychkov::Token::BAD_NUMBER:
+      std::cerr << "int suffix is not supplied\n";
+      return 1;
+    default:
       std::cerr << "input overflow\n";
       return 1;
     }
@@ -0,0 +1,73 @@
+#include <limits>
+#include <sstream>
+#include <string>
+#include <boost/test/unit_test.hpp>
+#include <lexer.hpp>
+
+BOOST_AUTO_TEST_SUITE(S1_lexer_test)
+
+BOOST_AUTO_TEST_CASE(kinds_test)
+{
+  std::istringstream in("first 1 +2 -1\t\nsecond 18446744073709551616 12a + -x");
+  rychkov::Lexer lexer(in);
+  rychkov::Token token = lexer.next();
+  BOOST_TEST(token.kind == rychkov::Token::NAME);
+  BOOST_TEST(std::string(token.data, token.size) == "first");
+  token = lexer.next();
+  BOOST_TEST(token.kind == rychkov::Token::NUMBER);
+  BOOST_TEST(token.number == 1);
+  BOOST_TEST(lexer.next().number == 2);
+  BOOST_TEST(lexer.next().number == std::numeric_limits< unsigned long long >::max());
+  BOOST_TEST(lexer.next().kind == rychkov::Token::NAME);
+  BOOST_TEST(lexer.next().kind == rychkov::Token::NUMBER_OVERFLOW);
+  BOOST_TEST(lexer.next().kind == rychkov::Token::BAD_NUMBER);
+  BOOST_TEST(lexer.next().kind == rychkov::Token::NAME);
+  BOOST_TEST(lexer.next().kind == rychkov::Token::NAME);
+  BOOST_TEST(lexer.next().kind == rychkov::Token::END);
+  BOOST_TEST(lexer.next().kind == rychkov::Token::END);
+}
+BOOST_AUTO_TEST_CASE(last_token_test)
+{
+  std::istringstream numbers("a 1 23");
+  rychkov::Lexer numberLexer(numbers);
+  BOOST_TEST(numberLexer.next().kind == rychkov::Token::NAME);
+  BOOST_TEST(numberLexer.next().number == 1);
+  rychkov::Token token = numberLexer.next();
+  BOOST_TEST(token.kind == rychkov::Token::NUMBER);
+  BOOST_TEST(std::string(token.data, token.size) == "23");
+  BOOST_TEST(token.number == 23);
+  BOOST_TEST(numberLexer.next().kind == rychkov::Token::END);
+
+  std::istringstream names("a 1 bc");
+  rychkov::Lexer nameLexer(names);
+  BOOST_TEST(nameLexer.next().kind == rychkov::Token::NAME);
+  BOOST_TEST(nameLexer.next().number == 1);
+  token = nameLexer.next();
+  BOOST_TEST(token.kind == rychkov::Token::NAME);
+  BOOST_TEST(std::string(token.data, token.size) == "bc");
+  BOOST_TEST(nameLexer.next().kind == rychkov::Token::END);
+}
+BOOST_AUTO_TEST_CASE(refill_test)
+{
+  std::string longName(rychkov::Lexer::initial_capacity * 3 / 2, 'a');
+  std::ostringstream out;
+  for (size_t i = 0; i < rychkov::Lexer::initial_capacity / 4; i++)
+  {
+    out << i << ' ';
+  }
+  out << longName;
+  std::istringstream in(out.str());
+  rychkov::Lexer lexer(in);
+  for (size_t i = 0; i < rychkov::Lexer::initial_capacity / 4; i++)
+  {
+    rychkov::Token token = lexer.next();
+    BOOST_TEST(token.kind == rychkov::Token::NUMBER);
+    BOOST_TEST(token.number == i);
+  }
+  rychkov::Token token = lexer.next();
+  BOOST_TEST(token.kind == rychkov::Token::NAME);
+  BOOST_TEST(std::string(token.data, token.size) == longName);
+  BOOST_TEST(lexer.next().kind == rychkov::Token::END);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -8,6 +8,35 @@ BOOST_AUTO_TEST_CASE(sort_test)
   list.sort();
   rychkov::fullCompare(list, {-3, -1, 3, 4, 4, 6, 7});
 }
+BOOST_AUTO_TEST_CASE(sort_runs_test)
+{
+  rychkov::List< int > list = {1, 2, 3, 9, 4, 5, 6, 0, 7, 8};
+  list.sort();
+  rychkov::fullCompare(list, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+  list.sort(std::greater<>());
+  rychkov::fullCompare(list, {9, 8, 7, 6, 5, 4, 3, 2, 1, 0});
+  list.sort();
+  rychkov::fullCompare(list, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+}
+BOOST_AUTO_TEST_CASE(sort_stability_test)
+{
+  using pair = std::pair< int, int >;
+  rychkov::List< pair > list;
+  for (int i = 0; i < 200; i++)
+  {
+    list.push_back({(i * 37) % 7, i});
+  }
+  list.sort([](const pair& lhs, const pair& rhs)
+      {
+        return lhs.first < rhs.first;
+      });
+  BOOST_TEST(list.size() == 200);
+  rychkov::List< pair >::const_iterator prev = list.begin();
+  for (rychkov::List< pair >::const_iterator i = ++list.begin(); i != list.end(); prev = i++)
+  {
+    BOOST_TEST(((prev->first < i->first) || ((prev->first == i->first) && (prev->second < i->second))));
+  }
+}
 BOOST_AUTO_TEST_CASE(merge_test)
 {
   rychkov::List< int > list1 = {-1, 3, 4, 6, 7};
@@ -15,12 +44,18 @@ BOOST_AUTO_TEST_CASE(merge_test)
   list1.merge(list2);
   rychkov::fullCompare(list1, {-1, 2, 3, 3, 4, 4, 6, 7, 8});
   rychkov::fullCompare(list2, {});
+  rychkov::List< int > empty;
+  empty.merge(list1);
+  rychkov::fullCompare(empty, {-1, 2, 3, 3, 4, 4, 6, 7, 8});
+  rychkov::fullCompare(list1, {});
 }
 BOOST_AUTO_TEST_CASE(unique_test)
 {
   rychkov::List< int > list = {-1, -1, 3, 3, 3, 3, 4, 6, 6, 7, 7, 7};
   BOOST_TEST(list.unique() == 7);
   rychkov::fullCompare(list, {-1, 3, 4, 6, 7});
+  rychkov::List< int > empty;
+  BOOST_TEST(empty.unique() == 0);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -4,6 +4,7 @@
 #include <chrono>
 #include <algorithm>
 #include <iterator>
+#include <string>
 #include <boost/test/unit_test.hpp>
 #include <mem_checker.hpp>
 #include <map.hpp>
@@ -101,4 +102,71 @@ BOOST_AUTO_TEST_CASE(random_test)
   }
 }
 
+BOOST_AUTO_TEST_CASE(wide_node_test)
+{
+  constexpr int input_size = 2048;
+  int data[input_size];
+  for (int i = 0; i < input_size; i++)
+  {
+    data[i] = i;
+  }
+  std::mt19937 engine;
+  std::shuffle(data, data + input_size, engine);
+  rychkov::Map< int, std::string, std::less<>, 16 > map;
+  for (int i: data)
+  {
+    map.try_emplace(i, std::to_string(i));
+  }
+  for (int i = 0; i < input_size; i += 2)
+  {
+    BOOST_TEST(map.erase(i) == 1);
+  }
+  BOOST_TEST(map.size() == input_size / 2);
+  for (int i = 0; i < input_size; i++)
+  {
+    decltype(map)::iterator found = map.find(i);
+    BOOST_TEST(((found == map.end()) == (i % 2 == 0)));
+    BOOST_TEST(map.lower_bound(i)->first == (i % 2 == 0 ? i + 1 : i));
+    if (i + 1 < input_size)
+    {
+      BOOST_TEST(map.upper_bound(i)->first == (i % 2 == 0 ? i + 1 : i + 2));
+    }
+  }
+  BOOST_TEST(map.at(5) == "5");
+}
+
+template< class Key, class Container >
+void check_bounds(const Container& container, const Key* data, size_t size)
+{
+  for (size_t i = 0; i < size; i++)
+  {
+    for (Key key: {data[i] - 1, data[i], data[i] + 1})
+    {
+      BOOST_TEST(std::distance(container.begin(), container.lower_bound(key)) == std::lower_bound(data, data + size, key) - data);
+      BOOST_TEST(std::distance(container.begin(), container.upper_bound(key)) == std::upper_bound(data, data + size, key) - data);
+    }
+  }
+}
+BOOST_AUTO_TEST_CASE(integral_search_test)
+{
+  constexpr size_t input_size = 1000;
+  int signed_data[input_size];
+  size_t unsigned_data[input_size];
+  std::mt19937 engine;
+  std::uniform_int_distribution< int > range(-300, 300);
+  rychkov::MultiSet< int, std::less<>, 32 > signed_set;
+  rychkov::Map< size_t, int, std::less< size_t >, 7 > unsigned_map;
+  for (size_t i = 0; i < input_size; i++)
+  {
+    signed_data[i] = range(engine);
+    signed_set.insert(signed_data[i]);
+    unsigned_data[i] = (i % 2 == 0 ? i : ~i);
+    unsigned_map.try_emplace(unsigned_data[i], 0);
+  }
+  std::sort(signed_data, signed_data + input_size);
+  std::sort(unsigned_data, unsigned_data + input_size);
+  check_bounds(signed_set, signed_data, input_size);
+  check_bounds(unsigned_map, unsigned_data, input_size);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -38,12 +38,14 @@ int main(int argc, char** argv)
   struct Accumulator
   {
     int sum = 0;
-    std::string str;
+    std::ostream* out = nullptr;
     void operator()(const std::pair< const int, std::string >& value)
     {
       sum = rychkov::safeAdd(sum, value.first);
-      str += ' ';
-      str += value.second;
+      if (out != nullptr)
+      {
+        *out << ' ' << value.second;
+      }
     }
   };
   Accumulator acc;
@@ -74,6 +76,10 @@ int main(int argc, char** argv)
   }
   else
   {
-    std::cout << acc.sum << acc.str << '\n';
+    std::cout << acc.sum;
+    Accumulator printer;
+    printer.out = &std::cout;
+    (map.*(call_p->second))(printer);
+    std::cout << '\n';
   }
 }
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <vector>
 #include <boost/test/unit_test.hpp>
 #include <set.hpp>
 #include <map.hpp>
@@ -54,4 +55,31 @@ BOOST_AUTO_TEST_CASE(iterator_test)
   BOOST_TEST((decltype(set)::reverse_iterator{rbreadth{set.rbegin()}} == set.rbegin()));
 }
 
+BOOST_AUTO_TEST_CASE(big_breadth_test)
+{
+  rychkov::Set< int > set;
+  for (int i = 0; i < 5000; i++)
+  {
+    set.insert((i * 37) % 5000);
+  }
+  using breadth = decltype(set)::const_breadth_iterator;
+  using rbreadth = decltype(set)::const_reverse_breadth_iterator;
+  std::vector< int > order(breadth{set.cend()}, breadth{});
+  std::vector< int > rorder(rbreadth{set.crend()}, rbreadth{});
+  BOOST_TEST(order.size() == set.size());
+  BOOST_TEST(rorder.size() == set.size());
+  BOOST_TEST(std::is_permutation(order.begin(), order.end(), set.begin()));
+  BOOST_TEST(std::is_permutation(rorder.begin(), rorder.end(), set.begin()));
+  for (size_t i = 0; i < order.size(); i += 97)
+  {
+    BOOST_TEST(std::equal(order.begin() + i, order.end(), breadth{set.find(order[i])}, breadth{}));
+    BOOST_TEST(std::equal(rorder.begin() + i, rorder.end(), rbreadth{std::find(set.crbegin(), set.crend(), rorder[i])}, rbreadth{}));
+  }
+
+  breadth i{set.cend()};
+  breadth copy = i++;
+  BOOST_TEST(*copy == order[0]);
+  BOOST_TEST(*i == order[1]);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
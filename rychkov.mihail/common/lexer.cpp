@@ -0,0 +1,129 @@
+#include "lexer.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+  bool isSpace(char c) noexcept
+  {
+    return (c == ' ') || ((c >= '\t') && (c <= '\r'));
+  }
+  bool isDigit(char c) noexcept
+  {
+    return (c >= '0') && (c <= '9');
+  }
+}
+
+constexpr size_t rychkov::Lexer::initial_capacity;
+
+rychkov::Lexer::Lexer(std::istream& in):
+  in_(in),
+  buffer_(new char[initial_capacity]),
+  capacity_(initial_capacity),
+  pos_(0),
+  end_(0)
+{}
+rychkov::Lexer::~Lexer()
+{
+  delete[] buffer_;
+}
+
+rychkov::Token rychkov::Lexer::next()
+{
+  while (true)
+  {
+    while ((pos_ < end_) && isSpace(buffer_[pos_]))
+    {
+      pos_++;
+    }
+    if (pos_ < end_)
+    {
+      break;
+    }
+    pos_ = 0;
+    end_ = 0;
+    if (!refill())
+    {
+      return {Token::END, nullptr, 0, 0};
+    }
+  }
+  size_t tokenEnd = pos_;
+  while (true)
+  {
+    while ((tokenEnd < end_) && !isSpace(buffer_[tokenEnd]))
+    {
+      tokenEnd++;
+    }
+    if (tokenEnd < end_)
+    {
+      break;
+    }
+    size_t offset = tokenEnd - pos_;
+    bool filled = refill();
+    tokenEnd = pos_ + offset;
+    if (!filled)
+    {
+      break;
+    }
+  }
+  Token result = classify(buffer_ + pos_, tokenEnd - pos_);
+  pos_ = tokenEnd;
+  return result;
+}
+
+bool rychkov::Lexer::refill()
+{
+  if (pos_ != 0)
+  {
+    std::copy(buffer_ + pos_, buffer_ + end_, buffer_);
+    end_ -= pos_;
+    pos_ = 0;
+  }
+  if (end_ == capacity_)
+  {
+    char* temp = new char[capacity_ * 2];
+    std::copy(buffer_, buffer_ + end_, temp);
+    delete[] buffer_;
+    buffer_ = temp;
+    capacity_ *= 2;
+  }
+  if (!in_.read(buffer_ + end_, capacity_ - end_) && (in_.gcount() == 0))
+  {
+    return false;
+  }
+  end_ += in_.gcount();
+  return true;
+}
+
+rychkov::Token rychkov::Lexer::classify(const char* data, size_t size) noexcept
+{
+  const char* i = data;
+  const char* end = data + size;
+  bool negative = false;
+  if ((size > 1) && ((*i == '+') || (*i == '-')))
+  {
+    negative = *i == '-';
+    i++;
+  }
+  if (!isDigit(*i))
+  {
+    return {Token::NAME, data, size, 0};
+  }
+  constexpr unsigned long long max = std::numeric_limits< unsigned long long >::max();
+  unsigned long long number = 0;
+  for (; (i != end) && isDigit(*i); i++)
+  {
+    unsigned digit = *i - '0';
+    if (number > (max - digit) / 10)
+    {
+      return {Token::NUMBER_OVERFLOW, data, size, 0};
+    }
+    number = number * 10 + digit;
+  }
+  if (i != end)
+  {
+    return {Token::BAD_NUMBER, data, size, 0};
+  }
+  return {Token::NUMBER, data, size, negative ? 0 - number : number};
+}
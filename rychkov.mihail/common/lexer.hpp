@@ -0,0 +1,48 @@
+#ifndef LEXER_HPP
+#define LEXER_HPP
+
+#include <cstddef>
+#include <istream>
+
+namespace rychkov
+{
+  struct Token
+  {
+    enum Kind
+    {
+      END,
+      NAME,
+      NUMBER,
+      BAD_NUMBER,
+      NUMBER_OVERFLOW
+    };
+    Kind kind;
+    const char* data;
+    size_t size;
+    unsigned long long number;
+  };
+
+  class Lexer
+  {
+  public:
+    static constexpr size_t initial_capacity = 1 << 16;
+
+    explicit Lexer(std::istream& in);
+    Lexer(const Lexer&) = delete;
+    ~Lexer();
+    Lexer& operator=(const Lexer&) = delete;
+
+    Token next();
+  private:
+    std::istream& in_;
+    char* buffer_;
+    size_t capacity_;
+    size_t pos_;
+    size_t end_;
+
+    bool refill();
+    static Token classify(const char* data, size_t size) noexcept;
+  };
+}
+
+#endif
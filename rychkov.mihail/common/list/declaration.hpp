@@ -2,6 +2,7 @@
 #define DECLARATION_HPP
 
 #include <initializer_list>
+#include <utility>
 
 #include "bidirectional_iterator.hpp"
 
@@ -127,8 +128,9 @@ namespace rychkov
 
     template< class C >
     bool compare(const List& rhs, C comp) const;
+    using run_t = std::pair< node_t< value_type >*, node_t< value_type >* >;
     template< class C >
-    const_iterator merge_sort(C& compare, const_iterator& from, size_t size_);
+    static run_t mergeRuns(C& compare, run_t left, run_t right);
     template< class C >
     const_iterator unsafeMerge(C& compare, const_iterator& from, const_iterator to,
         const_iterator insfrom, const_iterator insto);
@@ -16,6 +16,10 @@ template< class P >
 typename rychkov::List< T >::size_type rychkov::List< T >::unique(P predicate)
 {
   size_type result = 0;
+  if (size_ <= 1)
+  {
+    return result;
+  }
   const_iterator i = ++begin(), prev = begin();
   while (i != end())
   {
@@ -45,25 +49,107 @@ void rychkov::List< T >::sort(C compare)
   {
     return;
   }
-  const_iterator from = begin();
-  const_iterator to = merge_sort(compare, from, size_);
-  head_ = from.node_;
-  tail_ = to.node_;
-  head_->prev = nullptr;
-  tail_->next = nullptr;
+  constexpr size_t maxPending = 64;
+  constexpr size_t minRun = 16;
+  run_t pending[maxPending] = {};
+  node_t< value_type >* rest = head_;
+  while (rest != nullptr)
+  {
+    run_t run{rest, rest};
+    run.first->prev = nullptr;
+    if ((rest->next != nullptr) && compare(rest->next->data, rest->data))
+    {
+      rest = rest->next;
+      while ((rest != nullptr) && compare(rest->data, run.first->data))
+      {
+        node_t< value_type >* node = rest;
+        rest = rest->next;
+        node->next = run.first;
+        run.first->prev = node;
+        run.first = node;
+      }
+      run.first->prev = nullptr;
+      run.second->next = nullptr;
+    }
+    else
+    {
+      while ((run.second->next != nullptr) && !compare(run.second->next->data, run.second->data))
+      {
+        run.second = run.second->next;
+      }
+      rest = run.second->next;
+      run.second->next = nullptr;
+    }
+    for (size_t runSize = 1; (rest != nullptr) && (runSize < minRun); runSize++)
+    {
+      node_t< value_type >* node = rest;
+      rest = rest->next;
+      node_t< value_type >* pos = run.second;
+      while ((pos != nullptr) && compare(node->data, pos->data))
+      {
+        pos = pos->prev;
+      }
+      node->prev = pos;
+      node->next = (pos == nullptr ? run.first : pos->next);
+      (node->next == nullptr ? run.second : node->next->prev) = node;
+      (pos == nullptr ? run.first : pos->next) = node;
+    }
+    size_t i = 0;
+    for (; (i < maxPending - 1) && (pending[i].first != nullptr); i++)
+    {
+      run = mergeRuns(compare, pending[i], run);
+      pending[i] = {};
+    }
+    pending[i] = mergeRuns(compare, pending[i], run);
+  }
+  run_t result{};
+  for (size_t i = 0; i < maxPending; i++)
+  {
+    result = mergeRuns(compare, pending[i], result);
+  }
+  head_ = result.first;
+  tail_ = result.second;
 }
 template< class T >
 template< class C >
-typename rychkov::List< T >::const_iterator rychkov::List< T >::merge_sort(C& compare, const_iterator& from, size_t count)
+typename rychkov::List< T >::run_t rychkov::List< T >::mergeRuns(C& compare, run_t left, run_t right)
 {
-  if (count == 1)
+  if ((left.first == nullptr) || (right.first == nullptr))
+  {
+    return left.first != nullptr ? left : right;
+  }
+  run_t result{};
+  if (compare(right.first->data, left.first->data))
+  {
+    result.first = right.first;
+    right.first = right.first->next;
+  }
+  else
+  {
+    result.first = left.first;
+    left.first = left.first->next;
+  }
+  node_t< value_type >* insTail = result.first;
+  while ((left.first != nullptr) && (right.first != nullptr))
   {
-    return from;
+    node_t< value_type >*& taken = compare(right.first->data, left.first->data) ? right.first : left.first;
+    insTail->next = taken;
+    taken->prev = insTail;
+    insTail = taken;
+    taken = taken->next;
   }
-  const_iterator mid = merge_sort(compare, from, (count + 1) / 2);
-  const_iterator postMid = ++const_iterator{mid};
-  const_iterator to = merge_sort(compare, postMid, count / 2);
-  return unsafeMerge(compare, from, mid, postMid, to);
+  run_t& rest = (left.first != nullptr ? left : right);
+  insTail->next = rest.first;
+  if (rest.first == nullptr)
+  {
+    result.second = insTail;
+  }
+  else
+  {
+    rest.first->prev = insTail;
+    result.second = rest.second;
+  }
+  return result;
 }
 template< class T >
 template< class C >
@@ -130,6 +216,11 @@ void rychkov::List< T >::merge(List& rhs, C compare)
   {
     return;
   }
+  if (size_ == 0)
+  {
+    swap(rhs);
+    return;
+  }
   const_iterator from = begin();
   const_iterator to = unsafeMerge(compare, from, {tail_, tail_}, rhs.begin(), {rhs.tail_, rhs.tail_});
   size_ += rhs.size_;
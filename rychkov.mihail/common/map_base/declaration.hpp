@@ -246,6 +246,14 @@ namespace rychkov
     template< class K1 >
     const_iterator upper_bound_impl(const K1& key) const;
     template< class K1 >
+    std::pair< const_iterator, const_iterator > lower_bound_impl(const K1& key, std::true_type) const;
+    template< class K1 >
+    std::pair< const_iterator, const_iterator > lower_bound_impl(const K1& key, std::false_type) const;
+    template< class K1 >
+    const_iterator upper_bound_impl(const K1& key, std::true_type) const;
+    template< class K1 >
+    const_iterator upper_bound_impl(const K1& key, std::false_type) const;
+    template< class K1 >
     std::pair< const_iterator, bool > find_hint_pair(const K1& key) const;
     template< class K1 >
     std::pair< const_iterator, bool > correct_hint(const_iterator hint, const K1& key) const;
@@ -4,9 +4,8 @@
 #include <iterator>
 #include <type_traits>
 #include <utility>
-#include <stack.hpp>
-#include <queue.hpp>
 #include "node.hpp"
+#include "node_path.hpp"
 
 namespace rychkov
 {
@@ -38,38 +37,25 @@ namespace rychkov
     template< bool isConst1 = isConst >
     MapBaseHeavyIterator(typename std::enable_if_t< isConst && isConst1,
           MapBaseHeavyIterator< Value, N, RealValue, false, isReversed, isBreadth > > rhs):
-      container_(rhs.container_),
+      container_(std::move(rhs.container_)),
       pointed_(rhs.pointed_)
     {}
     MapBaseHeavyIterator(MapBaseIterator< Value, N, RealValue, isConst, isReversed > src):
       MapBaseHeavyIterator()
     {
-      if (isBreadth)
+      if (isBreadth && src.node_->isfake())
       {
-        if (src.node_->isfake())
+        if (src.node_->isleaf())
         {
-          if (src.node_->isleaf())
-          {
-            return;
-          }
-          container_.push(src.node_->children[0]);
-        }
-        else
-        {
-          decltype(src) fake = src;
-          for (; !fake.node_->isfake(); fake.move_up())
-          {}
-          MapBaseHeavyIterator i = fake;
-          for (; (i.top() != src.node_) || (i.pointed_ != src.pointed_); ++i)
-          {}
-          *this = std::move(i);
           return;
         }
+        container_.push(src.node_);
+        container_.push(src.node_->children[0]);
         pointed_ = (isReversed ? top()->size() - 1 : 0);
         return;
       }
       pointed_ = src.pointed_;
-      Stack< node_type* > temp;
+      container temp;
       temp.push(src.node_);
       for (; !temp.top()->isfake(); src.move_up(), temp.push(src.node_))
       {}
@@ -80,7 +66,7 @@ namespace rychkov
       }
     }
 
-    bool operator==(MapBaseHeavyIterator rhs) const noexcept
+    bool operator==(const MapBaseHeavyIterator& rhs) const noexcept
     {
       if (container_.empty() || rhs.container_.empty())
       {
@@ -88,14 +74,14 @@ namespace rychkov
       }
       return (top() == rhs.top()) && (pointed_ == rhs.pointed_);
     }
-    bool operator!=(MapBaseHeavyIterator rhs) const noexcept
+    bool operator!=(const MapBaseHeavyIterator& rhs) const noexcept
     {
       return !operator==(rhs);
     }
 
     MapBaseHeavyIterator& operator++()
     {
-      isReversed ? shift_left() : shift_right();
+      isBreadth ? shift_breadth() : isReversed ? shift_left() : shift_right();
       return *this;
     }
     MapBaseHeavyIterator operator++(int)
@@ -141,19 +127,14 @@ namespace rychkov
     friend class MapBaseHeavyIterator< Value, N, RealValue, true, isReversed, isBreadth >;
 
     using node_size_type = typename node_type::size_type;
-    using container = std::conditional_t< isBreadth, Queue< node_type* >, Stack< node_type* > >;
+    using container = details::MapBaseNodePath< node_type >;
     container container_;
     node_size_type pointed_;
 
     void shift_left();
     void shift_right();
-    template< bool isBreadth1 = isBreadth >
-    std::enable_if_t< isBreadth1 && isBreadth, node_type* > top() const noexcept
-    {
-      return container_.front();
-    }
-    template< bool isBreadth1 = isBreadth >
-    std::enable_if_t< !isBreadth1 && !isBreadth, node_type* > top() const noexcept
+    void shift_breadth();
+    node_type* top() const noexcept
     {
       return container_.top();
     }
@@ -163,27 +144,6 @@ namespace rychkov
 template< class Value, size_t N, class RealValue, bool isConst, bool isReversed, bool isBreadth >
 void rychkov::MapBaseHeavyIterator< Value, N, RealValue, isConst, isReversed, isBreadth >::shift_left()
 {
-  if (isBreadth)
-  {
-    if (!top()->isleaf())
-    {
-      container_.push(top()->children[pointed_ + 1]);
-    }
-    if (pointed_ > 0)
-    {
-      pointed_--;
-    }
-    else
-    {
-      if (!top()->isleaf())
-      {
-        container_.push(top()->children[0]);
-      }
-      container_.pop();
-      pointed_ = (container_.empty() ? 0 : top()->size() - 1);
-    }
-    return;
-  }
   if (top()->isfake() || !top()->isleaf())
   {
     container_.push(top()->children[top()->isfake() ? 0 : pointed_]);
@@ -218,27 +178,6 @@ void rychkov::MapBaseHeavyIterator< Value, N, RealValue, isConst, isReversed, is
 template< class Value, size_t N, class RealValue, bool isConst, bool isReversed, bool isBreadth >
 void rychkov::MapBaseHeavyIterator< Value, N, RealValue, isConst, isReversed, isBreadth >::shift_right()
 {
-  if (isBreadth)
-  {
-    if (!top()->isleaf())
-    {
-      container_.push(top()->children[pointed_]);
-    }
-    if (pointed_ + 1 < top()->size())
-    {
-      pointed_++;
-    }
-    else
-    {
-      if (!top()->isleaf())
-      {
-        container_.push(top()->children[pointed_ + 1]);
-      }
-      container_.pop();
-      pointed_ = 0;
-    }
-    return;
-  }
   if (top()->isfake() || !top()->isleaf())
   {
     container_.push(top()->children[top()->isfake() ? 0 : pointed_ + 1]);
@@ -266,5 +205,42 @@ void rychkov::MapBaseHeavyIterator< Value, N, RealValue, isConst, isReversed, is
     }
   }
 }
+template< class Value, size_t N, class RealValue, bool isConst, bool isReversed, bool isBreadth >
+void rychkov::MapBaseHeavyIterator< Value, N, RealValue, isConst, isReversed, isBreadth >::shift_breadth()
+{
+  if (isReversed ? (pointed_ > 0) : (pointed_ + 1 < top()->size()))
+  {
+    isReversed ? pointed_-- : pointed_++;
+    return;
+  }
+  typename container::size_type depth = container_.size();
+  bool isLastLevel = top()->isleaf();
+  node_type* prev = top();
+  container_.pop();
+  for (; !top()->isfake() && (top()->children[isReversed ? 0 : top()->size()] == prev);
+        prev = top(), container_.pop())
+  {}
+  if (top()->isfake())
+  {
+    if (isLastLevel)
+    {
+      container_.clear();
+      pointed_ = 0;
+      return;
+    }
+    depth++;
+    container_.push(top()->children[0]);
+  }
+  else
+  {
+    node_size_type i = 0;
+    for (; top()->children[i] != prev; i++)
+    {}
+    container_.push(top()->children[isReversed ? i - 1 : i + 1]);
+  }
+  for (; container_.size() < depth; container_.push(top()->children[isReversed ? top()->size() : 0]))
+  {}
+  pointed_ = (isReversed ? top()->size() - 1 : 0);
+}
 
 #endif
@@ -37,11 +37,11 @@ namespace rychkov
       node_(rhs.node_),
       pointed_(rhs.pointed_)
     {}
-    MapBaseIterator(MapBaseHeavyIterator< Value, N, RealValue, isConst, isReversed, false > src) noexcept:
+    MapBaseIterator(const MapBaseHeavyIterator< Value, N, RealValue, isConst, isReversed, false >& src) noexcept:
       node_(src.container_.empty() ? nullptr : src.top()),
       pointed_(src.pointed_)
     {}
-    MapBaseIterator(MapBaseHeavyIterator< Value, N, RealValue, isConst, isReversed, true > src) noexcept:
+    MapBaseIterator(const MapBaseHeavyIterator< Value, N, RealValue, isConst, isReversed, true >& src) noexcept:
       node_(src.container_.empty() ? nullptr : src.top()),
       pointed_(src.pointed_)
     {}
@@ -3,16 +3,41 @@
 
 #include <cstddef>
 #include <utility>
+#include <type_traits>
 #include <memory>
 #include <type_tools.hpp>
+#include "node_search.hpp"
 
 namespace rychkov
 {
+  namespace details
+  {
+    template< class Value >
+    struct node_key_of
+    {
+      using type = Value;
+      static const type& get(const Value& value) noexcept
+      {
+        return value;
+      }
+    };
+    template< class K, class T >
+    struct node_key_of< std::pair< K, T > >
+    {
+      using type = K;
+      static const type& get(const std::pair< K, T >& value) noexcept
+      {
+        return value.first;
+      }
+    };
+  }
+
   template< class Value, size_t N >
   class MapBaseNode
   {
   public:
     using value_type = Value;
+    using key_type = typename details::node_key_of< Value >::type;
     using size_type = select_size_type_t< N >;
     static constexpr size_t node_capacity = N;
 
@@ -34,7 +59,25 @@ namespace rychkov
     }
     const value_type& operator[](size_type i) const
     {
-      return *(reinterpret_cast< value_type* >(data_) + i);
+      return *(reinterpret_cast< const value_type* >(data_) + i);
+    }
+    const key_type& key(size_type i) const noexcept
+    {
+      return details::node_key_of< Value >::get(operator[](i));
+    }
+    template< class K1, class Compare >
+    using simd_searchable = std::integral_constant< bool, std::is_same< key_type, value_type >::value
+          && details::is_simd_searchable< key_type, K1, Compare, node_capacity >::value >;
+
+    template< class K1, class Compare >
+    size_type lower_index(const K1& pivot, const Compare& comp) const
+    {
+      return search_index< false >(pivot, comp, simd_searchable< K1, Compare >{});
+    }
+    template< class K1, class Compare >
+    size_type upper_index(const K1& pivot, const Compare& comp) const
+    {
+      return search_index< true >(pivot, comp, simd_searchable< K1, Compare >{});
     }
     bool empty() const noexcept
     {
@@ -107,6 +150,23 @@ namespace rychkov
   private:
     size_type size_ = 0;
     alignas(value_type) unsigned char data_[node_capacity * sizeof(value_type)];
+
+    template< bool Upper, class K1, class Compare >
+    size_type search_index(const K1& pivot, const Compare& comp, std::false_type) const
+    {
+      size_type i = 0;
+      while ((i < size_) && (Upper ? !comp(pivot, key(i)) : comp(key(i), pivot)))
+      {
+        i++;
+      }
+      return i;
+    }
+    template< bool Upper, class K1, class Compare >
+    size_type search_index(const K1& pivot, const Compare&, std::true_type) const
+    {
+      const key_type* keys = reinterpret_cast< const key_type* >(data_);
+      return static_cast< size_type >(details::count_before< Upper >(keys, size_, pivot));
+    }
   };
 }
 
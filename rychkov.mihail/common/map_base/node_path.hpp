@@ -0,0 +1,139 @@
+#ifndef MAP_BASE_NODE_PATH_HPP
+#define MAP_BASE_NODE_PATH_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+namespace rychkov
+{
+  namespace details
+  {
+    template< class Node >
+    class MapBaseNodePath
+    {
+    public:
+      using value_type = Node*;
+      using size_type = size_t;
+      static constexpr size_type inline_capacity = 32;
+
+      MapBaseNodePath() noexcept:
+        size_(0),
+        capacity_(inline_capacity),
+        data_(inline_)
+      {}
+      MapBaseNodePath(const MapBaseNodePath& rhs):
+        MapBaseNodePath()
+      {
+        reserve(rhs.size_);
+        std::copy(rhs.data_, rhs.data_ + rhs.size_, data_);
+        size_ = rhs.size_;
+      }
+      MapBaseNodePath(MapBaseNodePath&& rhs) noexcept:
+        MapBaseNodePath()
+      {
+        steal(rhs);
+      }
+      ~MapBaseNodePath()
+      {
+        release();
+      }
+
+      MapBaseNodePath& operator=(const MapBaseNodePath& rhs)
+      {
+        if (this != std::addressof(rhs))
+        {
+          reserve(rhs.size_);
+          std::copy(rhs.data_, rhs.data_ + rhs.size_, data_);
+          size_ = rhs.size_;
+        }
+        return *this;
+      }
+      MapBaseNodePath& operator=(MapBaseNodePath&& rhs) noexcept
+      {
+        if (this != std::addressof(rhs))
+        {
+          release();
+          steal(rhs);
+        }
+        return *this;
+      }
+
+      bool empty() const noexcept
+      {
+        return size_ == 0;
+      }
+      size_type size() const noexcept
+      {
+        return size_;
+      }
+      value_type top() const noexcept
+      {
+        return data_[size_ - 1];
+      }
+      void push(value_type node)
+      {
+        if (size_ >= capacity_)
+        {
+          reserve(capacity_ * 2);
+        }
+        data_[size_++] = node;
+      }
+      void pop() noexcept
+      {
+        size_--;
+      }
+      void clear() noexcept
+      {
+        size_ = 0;
+      }
+    private:
+      size_type size_, capacity_;
+      value_type* data_;
+      value_type inline_[inline_capacity];
+
+      void reserve(size_type newCapacity)
+      {
+        if (newCapacity <= capacity_)
+        {
+          return;
+        }
+        value_type* temp = new value_type[newCapacity];
+        std::copy(data_, data_ + size_, temp);
+        release();
+        data_ = temp;
+        capacity_ = newCapacity;
+      }
+      void release() noexcept
+      {
+        if (data_ != inline_)
+        {
+          delete[] data_;
+          data_ = inline_;
+          capacity_ = inline_capacity;
+        }
+        size_ = 0;
+      }
+      void steal(MapBaseNodePath& rhs) noexcept
+      {
+        if (rhs.data_ == rhs.inline_)
+        {
+          std::copy(rhs.inline_, rhs.inline_ + rhs.size_, inline_);
+        }
+        else
+        {
+          data_ = std::exchange(rhs.data_, rhs.inline_);
+          capacity_ = std::exchange(rhs.capacity_, inline_capacity);
+        }
+        size_ = std::exchange(rhs.size_, 0);
+      }
+    };
+  }
+}
+
+template< class Node >
+constexpr typename rychkov::details::MapBaseNodePath< Node >::size_type
+    rychkov::details::MapBaseNodePath< Node >::inline_capacity;
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef MAP_BASE_NODE_SEARCH_HPP
+#define MAP_BASE_NODE_SEARCH_HPP
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE4_2__)
+#include <nmmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace rychkov
+{
+  namespace details
+  {
+    template< class Key >
+    struct simd_lane_count: std::integral_constant< size_t,
+#if defined(__SSE4_2__)
+          ((sizeof(Key) == 4) || (sizeof(Key) == 8)) ? 16 / sizeof(Key) : 0
+#elif defined(__SSE2__)
+          (sizeof(Key) == 4) ? 4 : 0
+#else
+          0
+#endif
+          >
+    {};
+
+    constexpr size_t simd_min_vectors = 8;
+
+    template< class Key, class K1, class Compare, size_t N >
+    struct is_simd_searchable: std::integral_constant< bool, std::is_integral< Key >::value
+          && !std::is_same< Key, bool >::value && std::is_same< Key, K1 >::value
+          && (simd_lane_count< Key >::value != 0) && (N >= simd_min_vectors * simd_lane_count< Key >::value)
+          && (std::is_same< Compare, std::less<> >::value || std::is_same< Compare, std::less< Key > >::value) >
+    {};
+
+    template< bool Inclusive, class Key >
+    size_t scalar_count_before(const Key* keys, size_t from, size_t size, Key key) noexcept
+    {
+      while ((from < size) && (Inclusive ? !(key < keys[from]) : (keys[from] < key)))
+      {
+        from++;
+      }
+      return from;
+    }
+
+    template< bool Inclusive, class Key >
+    std::enable_if_t< sizeof(Key) == 4, size_t > count_before(const Key* keys, size_t size, Key key) noexcept
+    {
+      size_t i = 0;
+#if defined(__SSE2__)
+      constexpr int bias = std::is_signed< Key >::value ? 0 : static_cast< int >(0x80000000U);
+#if defined(__AVX2__)
+      const __m256i wide_flip = _mm256_set1_epi32(bias);
+      const __m256i wide_pivot = _mm256_xor_si256(_mm256_set1_epi32(static_cast< int >(key)), wide_flip);
+      for (; i + 8 <= size; i += 8)
+      {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast< const __m256i* >(keys + i));
+        chunk = _mm256_xor_si256(chunk, wide_flip);
+        int mask = Inclusive ? (~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(chunk, wide_pivot))) & 0xFF)
+              : _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(wide_pivot, chunk)));
+        if (mask != 0xFF)
+        {
+          return i + __builtin_popcount(mask);
+        }
+      }
+#endif
+      const __m128i flip = _mm_set1_epi32(bias);
+      const __m128i pivot = _mm_xor_si128(_mm_set1_epi32(static_cast< int >(key)), flip);
+      for (; i + 4 <= size; i += 4)
+      {
+        __m128i chunk = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast< const __m128i* >(keys + i)), flip);
+        int mask = Inclusive ? (~_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(chunk, pivot))) & 0xF)
+              : _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(chunk, pivot)));
+        if (mask != 0xF)
+        {
+          return i + __builtin_popcount(mask);
+        }
+      }
+#endif
+      return scalar_count_before< Inclusive >(keys, i, size, key);
+    }
+    template< bool Inclusive, class Key >
+    std::enable_if_t< sizeof(Key) == 8, size_t > count_before(const Key* keys, size_t size, Key key) noexcept
+    {
+      size_t i = 0;
+#if defined(__SSE4_2__)
+      constexpr long long bias = std::is_signed< Key >::value ? 0 : static_cast< long long >(0x8000000000000000ULL);
+#if defined(__AVX2__)
+      const __m256i wide_flip = _mm256_set1_epi64x(bias);
+      const __m256i wide_pivot = _mm256_xor_si256(_mm256_set1_epi64x(static_cast< long long >(key)), wide_flip);
+      for (; i + 4 <= size; i += 4)
+      {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast< const __m256i* >(keys + i));
+        chunk = _mm256_xor_si256(chunk, wide_flip);
+        int mask = Inclusive ? (~_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(chunk, wide_pivot))) & 0xF)
+              : _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(wide_pivot, chunk)));
+        if (mask != 0xF)
+        {
+          return i + __builtin_popcount(mask);
+        }
+      }
+#endif
+      const __m128i flip = _mm_set1_epi64x(bias);
+      const __m128i pivot = _mm_xor_si128(_mm_set1_epi64x(static_cast< long long >(key)), flip);
+      for (; i + 2 <= size; i += 2)
+      {
+        __m128i chunk = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast< const __m128i* >(keys + i)), flip);
+        int mask = Inclusive ? (~_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(chunk, pivot))) & 0x3)
+              : _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(pivot, chunk)));
+        if (mask != 0x3)
+        {
+          return i + __builtin_popcount(mask);
+        }
+      }
+#endif
+      return scalar_count_before< Inclusive >(keys, i, size, key);
+    }
+  }
+}
+
+#endif
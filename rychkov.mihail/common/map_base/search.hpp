@@ -52,6 +52,79 @@ template< class K1 >
 std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator,
       typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator >
     rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::lower_bound_impl(const K1& key) const
+{
+  return lower_bound_impl(key, typename node_type::template simd_searchable< K1, key_compare >{});
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K1 >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::upper_bound_impl(const K1& key) const
+{
+  return upper_bound_impl(key, typename node_type::template simd_searchable< K1, key_compare >{});
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K1 >
+std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator,
+      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::lower_bound_impl(const K1& key, std::true_type) const
+{
+  if (size_ == 0)
+  {
+    return {end(), end()};
+  }
+  const key_compare comp = key_comp();
+  const_iterator right = end();
+  node_type* node = fake_children_[0];
+  while (true)
+  {
+    node_size_type i = node->lower_index(key, comp);
+    const_iterator left = {node, i};
+    if (i < node->size())
+    {
+      right = left;
+      if (node->isleaf() || (!IsMulti && !compare_with_key(key, node->key(i))))
+      {
+        return {left, left};
+      }
+    }
+    else if (node->isleaf())
+    {
+      return {left, right};
+    }
+    node = node->children[i];
+  }
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K1 >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::upper_bound_impl(const K1& key, std::true_type) const
+{
+  if (size_ == 0)
+  {
+    return end();
+  }
+  const key_compare comp = key_comp();
+  const_iterator right = end();
+  node_type* node = fake_children_[0];
+  while (true)
+  {
+    node_size_type i = node->upper_index(key, comp);
+    if (i < node->size())
+    {
+      right = {node, i};
+    }
+    if (node->isleaf())
+    {
+      return right;
+    }
+    node = node->children[i];
+  }
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K1 >
+std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator,
+      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::lower_bound_impl(const K1& key, std::false_type) const
 {
   if (size_ == 0)
   {
@@ -100,7 +173,7 @@ std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterat
 template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
 template< class K1 >
 typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::upper_bound_impl(const K1& key) const
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::upper_bound_impl(const K1& key, std::false_type) const
 {
   if (size_ == 0)
   {
@@ -7,7 +7,8 @@ template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
 template< class Unary >
 Unary rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::traverse_lnr(Unary f) const
 {
-  for (const_heavy_iterator i = cbegin(); i != cend(); ++i)
+  const const_heavy_iterator end = cend();
+  for (const_heavy_iterator i = cbegin(); i != end; ++i)
   {
     f(*i);
   }
@@ -17,7 +18,8 @@ template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
 template< class Unary >
 Unary rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::traverse_rnl(Unary f) const
 {
-  for (const_reverse_heavy_iterator i = crbegin(); i != crend(); ++i)
+  const const_reverse_heavy_iterator end = crend();
+  for (const_reverse_heavy_iterator i = crbegin(); i != end; ++i)
   {
     f(*i);
   }
@@ -27,7 +29,8 @@ template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
 template< class Unary >
 Unary rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::traverse_breadth(Unary f) const
 {
-  for (const_breadth_iterator i = cend(); i != const_breadth_iterator{}; ++i)
+  const const_breadth_iterator end = const_breadth_iterator{};
+  for (const_breadth_iterator i = cend(); i != end; ++i)
   {
     f(*i);
   }
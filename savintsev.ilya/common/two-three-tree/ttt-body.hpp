@@ -430,44 +430,12 @@ namespace savintsev
   {
     assert(node->len < 3);
 
-    value_type tmp_data[3];
-    size_t tmp_len = node->len;
-
-    for (size_t i = 0; i < tmp_len; ++i)
-    {
-      tmp_data[i] = node->data[i];
-    }
-
-    tmp_data[tmp_len++] = val;
-
-    if (tmp_len == 2)
-    {
-      if (!Compare{}(tmp_data[0].first, tmp_data[1].first))
-      {
-        std::swap(tmp_data[0], tmp_data[1]);
-      }
-    }
-    else if (tmp_len == 3)
-    {
-      if (!Compare{}(tmp_data[0].first, tmp_data[1].first))
-      {
-        std::swap(tmp_data[0], tmp_data[1]);
-      }
-      if (!Compare{}(tmp_data[1].first, tmp_data[2].first))
-      {
-        std::swap(tmp_data[1], tmp_data[2]);
-      }
-      if (!Compare{}(tmp_data[0].first, tmp_data[1].first))
-      {
-        std::swap(tmp_data[0], tmp_data[1]);
-      }
-    }
-
-    for (size_t i = 0; i < tmp_len; ++i)
+    size_t pos = 0;
+    while (pos < node->len && Compare{}(node->data[pos].first, val.first))
     {
-      node->data[i] = std::move(tmp_data[i]);
+      ++pos;
     }
-    node->len = tmp_len;
+    node->emplace(pos, val);
   }
 
   template< typename Key, typename Value, typename Compare >
@@ -485,14 +453,11 @@ namespace savintsev
     }
     if (node->len >= 1 && node->data[0].first == k)
     {
-      node->data[0] = node->data[1];
-      node->data[1] = node->data[2];
-      node->len--;
+      node->erase(0);
     }
     else if (node->len == 2 && node->data[1].first == k)
     {
-      node->data[1] = node->data[2];
-      node->len--;
+      node->erase(1);
     }
   }
 
@@ -524,9 +489,8 @@ namespace savintsev
       root = new node_type{};
       for (size_t i = 0; i < other->len; ++i)
       {
-        root->data[i] = other->data[i];
+        root->emplace(i, other->data[i]);
       }
-      root->len = other->len;
       for (size_t i = 0; i < 3; ++i)
       {
         if (other->kids[i])
@@ -1090,12 +1054,13 @@ namespace savintsev
       {
         left->father = node;
         right->father = node;
-        node->data[0] = node->data[1];
+        node->data[0] = std::move(node->data[1]);
+        node->pop_back();
+        node->pop_back();
         node->kids[0] = left;
         node->kids[1] = right;
         node->kids[2] = nullptr;
         node->kids[3] = nullptr;
-        node->len = 1;
         return node;
       }
     }
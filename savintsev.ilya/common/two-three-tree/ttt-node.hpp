@@ -1,19 +1,91 @@
 #ifndef TTT_NODE_H
 #define TTT_NODE_H
 #include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
 
 namespace savintsev
 {
+  template< typename T, size_t N >
+  class raw_slots_t
+  {
+  public:
+    raw_slots_t() noexcept
+    {}
+
+    T & operator[](size_t i) noexcept
+    {
+      return *(reinterpret_cast< T * >(storage_) + i);
+    }
+    const T & operator[](size_t i) const noexcept
+    {
+      return *(reinterpret_cast< const T * >(storage_) + i);
+    }
+
+  private:
+    alignas(T) unsigned char storage_[N * sizeof(T)];
+  };
+
   template< typename T >
   struct node_t
   {
-    T data[3];
+    raw_slots_t< T, 3 > data;
 
     node_t * kids[4] = {nullptr, nullptr, nullptr, nullptr};
     node_t * father = nullptr;
 
     size_t len = 0;
+
+    node_t() = default;
+    node_t(const node_t &) = delete;
+    node_t & operator=(const node_t &) = delete;
+    ~node_t();
+
+    template< typename... Args >
+    void emplace(size_t pos, Args &&... args);
+    void erase(size_t pos) noexcept;
+    void pop_back() noexcept;
   };
+
+  template< typename T >
+  node_t< T >::~node_t()
+  {
+    while (len)
+    {
+      pop_back();
+    }
+  }
+
+  template< typename T >
+  template< typename... Args >
+  void node_t< T >::emplace(size_t pos, Args &&... args)
+  {
+    T tmp(std::forward< Args >(args)...);
+    for (size_t i = len; i > pos; --i)
+    {
+      new (std::addressof(data[i])) T(std::move(data[i - 1]));
+      data[i - 1].~T();
+    }
+    new (std::addressof(data[pos])) T(std::move(tmp));
+    ++len;
+  }
+
+  template< typename T >
+  void node_t< T >::erase(size_t pos) noexcept
+  {
+    for (size_t i = pos + 1; i < len; ++i)
+    {
+      data[i - 1] = std::move(data[i]);
+    }
+    pop_back();
+  }
+
+  template< typename T >
+  void node_t< T >::pop_back() noexcept
+  {
+    data[--len].~T();
+  }
 }
 
 #endif
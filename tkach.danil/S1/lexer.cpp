@@ -0,0 +1,136 @@
+#include "lexer.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+  bool isSpace(char c) noexcept
+  {
+    return (c == ' ') || ((c >= '\t') && (c <= '\r'));
+  }
+
+  bool isDigit(char c) noexcept
+  {
+    return (c >= '0') && (c <= '9');
+  }
+}
+
+constexpr size_t tkach::Lexer::initial_capacity;
+
+tkach::Lexer::Lexer(std::istream& in):
+  in_(in),
+  buffer_(new char[initial_capacity]),
+  capacity_(initial_capacity),
+  pos_(0),
+  end_(0)
+{}
+
+tkach::Lexer::~Lexer()
+{
+  delete[] buffer_;
+}
+
+bool tkach::Lexer::readWord(std::string& word)
+{
+  if (!skipSpaces())
+  {
+    return false;
+  }
+  size_t size = 0;
+  char c = 0;
+  while (peek(size, c) && !isSpace(c))
+  {
+    size++;
+  }
+  word.assign(buffer_ + pos_, size);
+  pos_ += size;
+  return true;
+}
+
+bool tkach::Lexer::readNumber(size_t& number)
+{
+  if (!skipSpaces())
+  {
+    return false;
+  }
+  size_t size = 0;
+  char c = buffer_[pos_];
+  bool negative = false;
+  if ((c == '+') || (c == '-'))
+  {
+    negative = (c == '-');
+    size++;
+  }
+  if (!peek(size, c) || !isDigit(c))
+  {
+    pos_ += size;
+    return false;
+  }
+  const size_t max = std::numeric_limits< size_t >::max();
+  size_t value = 0;
+  bool overflow = false;
+  while (peek(size, c) && isDigit(c))
+  {
+    size_t digit = c - '0';
+    if (value > (max - digit) / 10)
+    {
+      overflow = true;
+    }
+    value = value * 10 + digit;
+    size++;
+  }
+  pos_ += size;
+  if (overflow)
+  {
+    return false;
+  }
+  number = negative ? 0 - value : value;
+  return true;
+}
+
+bool tkach::Lexer::peek(size_t offset, char& c)
+{
+  while (pos_ + offset >= end_)
+  {
+    if (!refill())
+    {
+      return false;
+    }
+  }
+  c = buffer_[pos_ + offset];
+  return true;
+}
+
+bool tkach::Lexer::skipSpaces()
+{
+  char c = 0;
+  while (peek(0, c) && isSpace(c))
+  {
+    pos_++;
+  }
+  return pos_ < end_;
+}
+
+bool tkach::Lexer::refill()
+{
+  if (pos_ != 0)
+  {
+    std::copy(buffer_ + pos_, buffer_ + end_, buffer_);
+    end_ -= pos_;
+    pos_ = 0;
+  }
+  if (end_ == capacity_)
+  {
+    char* temp = new char[capacity_ * 2];
+    std::copy(buffer_, buffer_ + end_, temp);
+    delete[] buffer_;
+    buffer_ = temp;
+    capacity_ *= 2;
+  }
+  if (!in_.read(buffer_ + end_, capacity_ - end_) && (in_.gcount() == 0))
+  {
+    return false;
+  }
+  end_ += in_.gcount();
+  return true;
+}
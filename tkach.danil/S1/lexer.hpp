@@ -0,0 +1,32 @@
+#ifndef LEXER_HPP
+#define LEXER_HPP
+
+#include <cstddef>
+#include <istream>
+#include <string>
+
+namespace tkach
+{
+  class Lexer
+  {
+  public:
+    static constexpr size_t initial_capacity = 1 << 16;
+    explicit Lexer(std::istream& in);
+    Lexer(const Lexer&) = delete;
+    ~Lexer();
+    Lexer& operator=(const Lexer&) = delete;
+    bool readWord(std::string& word);
+    bool readNumber(size_t& number);
+  private:
+    std::istream& in_;
+    char* buffer_;
+    size_t capacity_;
+    size_t pos_;
+    size_t end_;
+    bool peek(size_t offset, char& c);
+    bool skipSpaces();
+    bool refill();
+  };
+}
+
+#endif
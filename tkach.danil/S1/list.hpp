@@ -3,28 +3,36 @@
 
 #include <cstddef>
 #include <initializer_list>
+#include <memory>
+#include <type_traits>
 #include <utility>
 #include "node.hpp"
+#include "node_pool.hpp"
 #include "list_const_iterator.hpp"
 #include "list_iterator.hpp"
 
 namespace tkach
 {
-  template< typename T >
+  template< typename T, typename Alloc = std::allocator< T > >
   class List
   {
   public:
+    using allocator_type = Alloc;
+    using node_allocator = typename std::allocator_traits< Alloc >::template rebind_alloc< Node< T > >;
+    using pool_type = NodePool< Node< T >, node_allocator >;
     List();
-    List(const List< T >& other);
-    List(List< T >&& other) noexcept;
+    explicit List(const Alloc& alloc);
+    explicit List(std::shared_ptr< pool_type > pool) noexcept;
+    List(const List< T, Alloc >& other);
+    List(List< T, Alloc >&& other) noexcept;
     List(size_t count, const T & data);
     template< class InputIt >
     List(InputIt first, InputIt last);
     List(std::initializer_list< T > in_list);
     ~List();
-    List< T >& operator=(const List< T >& other);
-    List< T >& operator=(List< T >&& other) noexcept;
-    List< T >& operator=(std::initializer_list< T > in_list);
+    List< T, Alloc >& operator=(const List< T, Alloc >& other);
+    List< T, Alloc >& operator=(List< T, Alloc >&& other) noexcept;
+    List< T, Alloc >& operator=(std::initializer_list< T > in_list);
     Iterator< T > begin() noexcept;
     Citerator< T > cbegin() const noexcept;
     Iterator< T > end() noexcept;
@@ -37,13 +45,15 @@ namespace tkach
     void pushFront(const T& data);
     void pushBack(T&& data);
     void pushBack(const T& data);
+    template< class... Args >
+    void emplaceBack(Args&&... args);
     void popFront();
-    void spliceAfter(Citerator< T > pos, List< T >& other);
-    void spliceAfter(Citerator< T > pos, List< T >&& other);
-    void spliceAfter(Citerator< T > pos, List< T >& other, Citerator< T > first);
-    void spliceAfter(Citerator< T > pos, List< T >&& other, Citerator< T > first);
-    void spliceAfter(Citerator< T > pos, List< T >& other, Citerator< T > first, Citerator< T > last);
-    void spliceAfter(Citerator< T > pos, List< T >&& other, Citerator< T > first, Citerator< T > last);
+    void spliceAfter(Citerator< T > pos, List< T, Alloc >& other);
+    void spliceAfter(Citerator< T > pos, List< T, Alloc >&& other);
+    void spliceAfter(Citerator< T > pos, List< T, Alloc >& other, Citerator< T > first);
+    void spliceAfter(Citerator< T > pos, List< T, Alloc >&& other, Citerator< T > first);
+    void spliceAfter(Citerator< T > pos, List< T, Alloc >& other, Citerator< T > first, Citerator< T > last);
+    void spliceAfter(Citerator< T > pos, List< T, Alloc >&& other, Citerator< T > first, Citerator< T > last);
     void remove(const T& value);
     template< class UnaryPredicate >
     void removeIf(UnaryPredicate p);
@@ -60,12 +70,22 @@ namespace tkach
     Iterator< T > eraseAfter(Citerator < T > pos);
     Iterator< T > eraseAfter(Citerator < T > first, Citerator < T > last);
     void clear();
-    void swap(List< T >& other) noexcept;
+    void swap(List< T, Alloc >& other) noexcept;
+    std::shared_ptr< pool_type > getPool();
   private:
+    static constexpr size_t loose_limit = 1;
     Node< T >* tail_;
     size_t size_;
-    List< T > getList(const List< T >& other) const;
-    List< T > getList(size_t count, const T & data) const;
+    node_allocator alloc_;
+    std::shared_ptr< pool_type > pool_;
+    template< class... Args >
+    Node< T >* createNode(Node< T >* next, Args&&... args);
+    void destroyNode(Node< T >* node) noexcept;
+    void deallocateNode(Node< T >* node) noexcept;
+    void sharePool(List< T, Alloc >& other);
+    void adoptNodes(pool_type& pool) noexcept;
+    List< T, Alloc > getList(const List< T, Alloc >& other) const;
+    List< T, Alloc > getList(size_t count, const T & data) const;
     template< class... Args >
     void pushFt(Args&&... args);
     template< class... Args >
@@ -74,15 +94,30 @@ namespace tkach
     Iterator< T > insertAft(Citerator< T > pos, Args&&... args);
   };
 
-  template< typename T >
-  List< T >::List():
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List():
+    List(Alloc())
+  {}
+
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(const Alloc& alloc):
     tail_(nullptr),
-    size_(0)
+    size_(0),
+    alloc_(alloc),
+    pool_()
   {}
 
-  template< typename T >
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(std::shared_ptr< pool_type > pool) noexcept:
+    tail_(nullptr),
+    size_(0),
+    alloc_(),
+    pool_(std::move(pool))
+  {}
+
+  template< typename T, typename Alloc >
   template< typename InputIt >
-  List< T >::List(InputIt first, InputIt last):
+  List< T, Alloc >::List(InputIt first, InputIt last):
     List()
   {
     if (first == last)
@@ -103,21 +138,21 @@ namespace tkach
     }
   }
 
-  template< typename T >
-  List< T >::List(std::initializer_list< T > in_list):
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(std::initializer_list< T > in_list):
     List(in_list.begin(), in_list.end())
   {}
 
-  template< typename T >
-  bool List< T >::empty() const noexcept
+  template< typename T, typename Alloc >
+  bool List< T, Alloc >::empty() const noexcept
   {
     return size_ == 0;
   }
 
-  template< typename T >
-  List< T > List< T >::getList(const List< T >& other) const
+  template< typename T, typename Alloc >
+  List< T, Alloc > List< T, Alloc >::getList(const List< T, Alloc >& other) const
   {
-    List< T > temp;
+    List< T, Alloc > temp(Alloc(other.alloc_));
     if (other.empty())
     {
       return temp;
@@ -130,10 +165,10 @@ namespace tkach
     return temp;
   }
 
-  template< typename T >
-  List< T > List< T >::getList(size_t count, const T & data) const
+  template< typename T, typename Alloc >
+  List< T, Alloc > List< T, Alloc >::getList(size_t count, const T & data) const
   {
-    List< T > temp;
+    List< T, Alloc > temp;
     for (size_t i = 0; i < count; ++i)
     {
       temp.pushFront(data);
@@ -141,126 +176,220 @@ namespace tkach
     return temp;
   }
 
-  template< typename T >
-  List< T >::List(const size_t count, const T & data):
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(const size_t count, const T & data):
     List(getList(count, data))
   {}
 
-  template< typename T >
-  Iterator< T > List< T >::begin() noexcept
+  template< typename T, typename Alloc >
+  Iterator< T > List< T, Alloc >::begin() noexcept
   {
     return Iterator< T >(tail_->next_);
   }
 
-  template< typename T >
-  Iterator< T > List< T >::end() noexcept
+  template< typename T, typename Alloc >
+  Iterator< T > List< T, Alloc >::end() noexcept
   {
     return Iterator< T >(tail_->next_);
   }
 
-  template< typename T >
-  Citerator< T > List< T >::cbegin() const noexcept
+  template< typename T, typename Alloc >
+  Citerator< T > List< T, Alloc >::cbegin() const noexcept
   {
     return Citerator< T >(tail_->next_);
   }
 
-  template< typename T >
-  Citerator< T > List< T >::cend() const noexcept
+  template< typename T, typename Alloc >
+  Citerator< T > List< T, Alloc >::cend() const noexcept
   {
     return Citerator< T >(tail_->next_);
   }
 
-  template< typename T >
-  T& List< T >::front()
+  template< typename T, typename Alloc >
+  T& List< T, Alloc >::front()
   {
-    return const_cast< T& >(static_cast< const List< T >* >(this)->front());
+    return const_cast< T& >(static_cast< const List< T, Alloc >* >(this)->front());
   }
 
-  template< typename T >
-  const T& List< T >::front() const
+  template< typename T, typename Alloc >
+  const T& List< T, Alloc >::front() const
   {
     return tail_->next_->data_;
   }
 
-  template< typename T >
-  size_t List< T >::size() const
+  template< typename T, typename Alloc >
+  size_t List< T, Alloc >::size() const
   {
     return size_;
   }
 
-  template< typename T >
-  void List< T >::swap(List< T >& other) noexcept
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::swap(List< T, Alloc >& other) noexcept
   {
     std::swap(tail_, other.tail_);
     std::swap(size_, other.size_);
+    std::swap(alloc_, other.alloc_);
+    std::swap(pool_, other.pool_);
+  }
+
+  template< typename T, typename Alloc >
+  std::shared_ptr< typename List< T, Alloc >::pool_type > List< T, Alloc >::getPool()
+  {
+    if (!pool_)
+    {
+      pool_ = std::allocate_shared< pool_type >(alloc_, alloc_);
+      adoptNodes(*pool_);
+    }
+    return pool_;
+  }
+
+  template< typename T, typename Alloc >
+  template< class... Args >
+  Node< T >* List< T, Alloc >::createNode(Node< T >* next, Args&&... args)
+  {
+    Node< T >* place = nullptr;
+    if (pool_)
+    {
+      place = pool_->allocate();
+    }
+    else if (size_ < loose_limit)
+    {
+      place = pool_type::allocateSingle(alloc_);
+    }
+    else
+    {
+      place = getPool()->allocate();
+    }
+    try
+    {
+      return new (place) Node< T >{next, std::forward< Args >(args)...};
+    }
+    catch (...)
+    {
+      deallocateNode(place);
+      throw;
+    }
+  }
+
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::destroyNode(Node< T >* node) noexcept
+  {
+    node->~Node();
+    deallocateNode(node);
+  }
+
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::deallocateNode(Node< T >* node) noexcept
+  {
+    if (pool_)
+    {
+      pool_->deallocate(node);
+    }
+    else
+    {
+      pool_type::deallocateSingle(alloc_, node);
+    }
+  }
+
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::sharePool(List< T, Alloc >& other)
+  {
+    if (this == std::addressof(other))
+    {
+      return;
+    }
+    if (!other.pool_)
+    {
+      other.adoptNodes(*getPool());
+      other.pool_ = pool_;
+      return;
+    }
+    if (!pool_)
+    {
+      adoptNodes(*other.pool_);
+      pool_ = other.pool_;
+      return;
+    }
+    pool_type::merge(pool_, other.pool_);
+  }
+
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::adoptNodes(pool_type& pool) noexcept
+  {
+    Node< T >* node = tail_;
+    for (size_t i = 0; i < size_; ++i)
+    {
+      node = node->next_;
+      pool.adopt(node);
+    }
   }
 
-  template< typename T >
-  void List< T >::pushFront(T&& data)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::pushFront(T&& data)
   {
     pushFt(std::move(data));
   }
 
-  template< typename T >
-  void List< T >::pushFront(const T& data)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::pushFront(const T& data)
   {
     pushFt(data);
   }
 
-  template< typename T >
-  void List< T >::pushBack(T&& data)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::pushBack(T&& data)
   {
     pushBk(std::move(data));
   }
 
-  template< typename T >
-  void List< T >::pushBack(const T& data)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::pushBack(const T& data)
   {
     pushBk(data);
   }
 
-  template< typename T >
-  List< T >::List(const List< T >& other):
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(const List< T, Alloc >& other):
     List(getList(other))
   {}
 
-  template< typename T >
-  List< T >& List< T >::operator=(const List< T >& other)
+  template< typename T, typename Alloc >
+  List< T, Alloc >& List< T, Alloc >::operator=(const List< T, Alloc >& other)
   {
     if (this == std::addressof(other))
     {
       return *this;
     }
-    List< T > temp(other);
+    List< T, Alloc > temp(other);
     swap(temp);
     return *this;
   }
 
-  template< typename T >
-  List< T >& List< T >::operator=(List< T >&& other) noexcept
+  template< typename T, typename Alloc >
+  List< T, Alloc >& List< T, Alloc >::operator=(List< T, Alloc >&& other) noexcept
   {
     if (this == std::addressof(other))
     {
       return *this;
     }
-    List< T > temp(std::move(other));
+    List< T, Alloc > temp(std::move(other));
     swap(temp);
     return *this;
   }
 
-  template< typename T >
-  List< T >& List< T >::operator=(std::initializer_list< T > in_list)
+  template< typename T, typename Alloc >
+  List< T, Alloc >& List< T, Alloc >::operator=(std::initializer_list< T > in_list)
   {
-    List< T > temp(std::move(in_list));
+    List< T, Alloc > temp(std::move(in_list));
     swap(temp);
     return *this;
   }
 
-  template< class T >
+  template< typename T, typename Alloc >
   template< class... Args >
-  void List< T >::pushFt(Args&&... args)
+  void List< T, Alloc >::pushFt(Args&&... args)
   {
-    Node< T >* new_node = new Node< T >{nullptr, std::forward< Args >(args)...};
+    Node< T >* new_node = createNode(nullptr, std::forward< Args >(args)...);
     if (empty())
     {
       tail_ = new_node;
@@ -274,11 +403,11 @@ namespace tkach
     size_++;
   }
 
-  template< class T >
+  template< typename T, typename Alloc >
   template< class... Args >
-  void List< T >::pushBk(Args&&... args)
+  void List< T, Alloc >::pushBk(Args&&... args)
   {
-    Node< T >* new_node = new Node< T >{nullptr, std::forward< Args >(args)...};
+    Node< T >* new_node = createNode(nullptr, std::forward< Args >(args)...);
     if (empty())
     {
       tail_ = new_node;
@@ -293,8 +422,15 @@ namespace tkach
     size_++;
   }
 
-  template< typename T >
-  void List< T >::popFront()
+  template< typename T, typename Alloc >
+  template< class... Args >
+  void List< T, Alloc >::emplaceBack(Args&&... args)
+  {
+    pushBk(std::forward< Args >(args)...);
+  }
+
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::popFront()
   {
     if (empty())
     {
@@ -303,17 +439,24 @@ namespace tkach
     eraseAfter(Citerator< T >(tail_));
   }
 
-  template< typename T >
-  void List< T >::clear()
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::clear()
   {
+    if (std::is_trivially_destructible< T >::value && pool_.use_count() == 1 && !pool_->merged())
+    {
+      pool_->release();
+      tail_ = nullptr;
+      size_ = 0;
+      return;
+    }
     while (tail_)
     {
       popFront();
     }
   }
 
-  template< typename T >
-  void List< T >::remove(const T& value)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::remove(const T& value)
   {
     removeIf(
       [&](const T& temp)
@@ -323,9 +466,9 @@ namespace tkach
     );
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< class UnaryPredicate >
-  void List< T >::removeIf(UnaryPredicate p)
+  void List< T, Alloc >::removeIf(UnaryPredicate p)
   {
     if (empty())
     {
@@ -349,23 +492,25 @@ namespace tkach
     }
   }
 
-  template< typename T >
-  List< T >::~List()
+  template< typename T, typename Alloc >
+  List< T, Alloc >::~List()
   {
     clear();
   }
 
-  template< typename T >
-  List< T >::List(List< T >&& other) noexcept:
+  template< typename T, typename Alloc >
+  List< T, Alloc >::List(List< T, Alloc >&& other) noexcept:
     tail_(other.tail_),
-    size_(other.size_)
+    size_(other.size_),
+    alloc_(other.alloc_),
+    pool_(std::move(other.pool_))
   {
     other.tail_ = nullptr;
     other.size_ = 0;
   }
 
-  template< typename T >
-  Iterator< T > List< T >::eraseAfter(Citerator< T > pos)
+  template< typename T, typename Alloc >
+  Iterator< T > List< T, Alloc >::eraseAfter(Citerator< T > pos)
   {
     if (empty())
     {
@@ -373,7 +518,7 @@ namespace tkach
     }
     if (tail_->next_ == tail_)
     {
-      delete tail_;
+      destroyNode(tail_);
       tail_ = nullptr;
       size_--;
       return Iterator< T >();
@@ -387,27 +532,28 @@ namespace tkach
         tail_ = pos.node_;
       }
       it.node_->next_ = list_delete->next_;
-      delete list_delete;
+      destroyNode(list_delete);
       size_--;
       return Iterator< T >(it.node_->next_);
     }
     return Iterator< T >();
   }
 
-  template< typename T >
-  void List< T >::assign(size_t count, const T& value)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::assign(size_t count, const T& value)
   {
-    List< T > temp(count, value);
+    List< T, Alloc > temp(count, value);
     swap(temp);
   }
 
-  template< typename T >
-  void List< T >::spliceAfter(Citerator< T > pos, List< T >& other)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::spliceAfter(Citerator< T > pos, List< T, Alloc >& other)
   {
     if (other.empty())
     {
       return;
     }
+    sharePool(other);
     Node< T >* temp = pos.node_;
     Node< T >* temp2 = temp->next_;
     if (temp == tail_)
@@ -421,79 +567,77 @@ namespace tkach
     other.size_ = 0;
   }
 
-  template< typename T >
-  void List< T >::spliceAfter(Citerator< T > pos, List< T >&& other)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::spliceAfter(Citerator< T > pos, List< T, Alloc >&& other)
   {
     spliceAfter(pos, other);
   }
 
-  template< typename T >
-  void List< T >::spliceAfter(Citerator< T > pos, List< T >& other, Citerator< T > first)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::spliceAfter(Citerator< T > pos, List< T, Alloc >& other, Citerator< T > first)
   {
     spliceAfter(pos, other, first, std::next(first, 2));
   }
 
-  template< typename T >
-  void List< T >::spliceAfter(Citerator< T > pos, List< T >&& other, Citerator< T > first)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::spliceAfter(Citerator< T > pos, List< T, Alloc >&& other, Citerator< T > first)
   {
     spliceAfter(pos, other, first, std::next(first, 2));
   }
 
-  template< typename T >
-  void List< T >::spliceAfter(Citerator< T > pos, List< T >& other, Citerator< T > first, Citerator< T > last)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::spliceAfter(Citerator< T > pos, List< T, Alloc >& other, Citerator< T > first, Citerator< T > last)
   {
     if (other.empty() || first.node_ == nullptr || last.node_ == nullptr || (std::next(first) == last))
     {
       return;
     }
     size_t splice_size = std::distance(first, last) - 1;
+    if (first.node_ == (other.tail_)->next_ && last.node_ == (other.tail_)->next_)
+    {
+      splice_size = other.size() - 1;
+    }
+    sharePool(other);
     Node< T >* temp = pos.node_;
     Node< T >* temp_first = first.node_;
     Node< T >* temp_last = last.node_;
     Node< T >* temp_next = temp->next_;
-    if (first.node_ == (other.tail_)->next_ && last.node_ == (other.tail_)->next_)
-    {
-      size_ += other.size() - 1;
-      other.size_ = 1;
-    }
-    else
-    {
-      size_ += splice_size;
-      other.size_ -= splice_size;
-    }
+    size_ += splice_size;
+    other.size_ -= splice_size;
     if (last.node_ == (other.tail_)->next_)
     {
       other.tail_ = temp_first;
     }
-    if (temp == tail_)
-    {
-      tail_ = temp_last;
-    }
+    bool at_tail = (temp == tail_);
     temp->next_ = temp_first->next_;
     while (temp->next_ != temp_last)
     {
       temp = temp->next_;
     }
+    if (at_tail)
+    {
+      tail_ = temp;
+    }
     temp->next_ = temp_next;
     temp_first->next_ = temp_last;
   }
 
-  template< typename T >
-  void List< T >::spliceAfter(Citerator< T > pos, List< T >&& other, Citerator< T > first, Citerator< T > last)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::spliceAfter(Citerator< T > pos, List< T, Alloc >&& other, Citerator< T > first, Citerator< T > last)
   {
     spliceAfter(pos, other, first, last);
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< class... Args >
-  Iterator< T > List< T >::insertAft(Citerator< T > pos, Args&&... args)
+  Iterator< T > List< T, Alloc >::insertAft(Citerator< T > pos, Args&&... args)
   {
     if (empty())
     {
       return Iterator< T >();
     }
     Node< T >* temp = pos.node_;
-    Node< T >* new_node = new Node< T >{temp->next_, std::forward< Args >(args)...};
+    Node< T >* new_node = createNode(temp->next_, std::forward< Args >(args)...);
     if (temp == tail_)
     {
       tail_ = new_node;
@@ -503,23 +647,28 @@ namespace tkach
     return Iterator< T >(new_node);
   }
 
-  template< typename T >
-  Iterator< T > List< T >::insertAfter(Citerator< T > pos, T&& value)
+  template< typename T, typename Alloc >
+  Iterator< T > List< T, Alloc >::insertAfter(Citerator< T > pos, T&& value)
   {
     return insertAft(pos, std::move(value));
   }
 
-  template< typename T >
-  Iterator< T > List< T >::insertAfter(Citerator< T > pos, const T& value)
+  template< typename T, typename Alloc >
+  Iterator< T > List< T, Alloc >::insertAfter(Citerator< T > pos, const T& value)
   {
     return insertAft(pos, value);
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< class InputIt >
-  Iterator< T > List< T >::insertAfter(Citerator < T > pos, InputIt first, InputIt last)
+  Iterator< T > List< T, Alloc >::insertAfter(Citerator < T > pos, InputIt first, InputIt last)
   {
-    spliceAfter(pos, List< T >(first, last));
+    List< T, Alloc > temp(getPool());
+    for (InputIt it = first; it != last; ++it)
+    {
+      temp.pushBack(*it);
+    }
+    spliceAfter(pos, temp);
     size_t splice_size = std::distance(first, last);
     for (size_t i = 0; i < splice_size; ++i)
     {
@@ -528,16 +677,21 @@ namespace tkach
     return Iterator< T >(pos.node_);
   }
 
-  template< typename T >
-  Iterator< T > List< T >::insertAfter(Citerator < T > pos, std::initializer_list< T > in_list)
+  template< typename T, typename Alloc >
+  Iterator< T > List< T, Alloc >::insertAfter(Citerator < T > pos, std::initializer_list< T > in_list)
   {
     return insertAfter(pos, in_list.begin(), in_list.end());
   }
 
-  template< typename T >
-  Iterator< T > List< T >::insertAfter(Citerator< T > pos, size_t count, const T & data)
+  template< typename T, typename Alloc >
+  Iterator< T > List< T, Alloc >::insertAfter(Citerator< T > pos, size_t count, const T & data)
   {
-    spliceAfter(pos, List< T >(count, data));
+    List< T, Alloc > temp(getPool());
+    for (size_t i = 0; i < count; ++i)
+    {
+      temp.pushFront(data);
+    }
+    spliceAfter(pos, temp);
     for (size_t i = 0; i < count; ++i)
     {
       ++pos;
@@ -545,23 +699,23 @@ namespace tkach
     return Iterator< T >(pos.node_);
   }
 
-  template< typename T >
+  template< typename T, typename Alloc >
   template< class InputIt >
-  void List< T >::assign(InputIt first, InputIt last)
+  void List< T, Alloc >::assign(InputIt first, InputIt last)
   {
-    List< T > temp(first, last);
+    List< T, Alloc > temp(first, last);
     swap(temp);
   }
 
-  template< typename T >
-  void List< T >::assign(std::initializer_list< T > in_list)
+  template< typename T, typename Alloc >
+  void List< T, Alloc >::assign(std::initializer_list< T > in_list)
   {
-    List< T > temp(in_list);
+    List< T, Alloc > temp(in_list);
     swap(temp);
   }
 
-  template< typename T >
-  Iterator< T > List< T >::eraseAfter(Citerator< T > first, Citerator< T > last)
+  template< typename T, typename Alloc >
+  Iterator< T > List< T, Alloc >::eraseAfter(Citerator< T > first, Citerator< T > last)
   {
     while (std::next(first) != last)
     {
@@ -6,13 +6,14 @@
 
 namespace tkach
 {
-  template< typename T >
+  template< typename T, typename Alloc >
   class List;
 
   template< typename T >
   class Citerator: public std::iterator< std::forward_iterator_tag, T >
   {
-    friend class List < T >;
+    template< typename U, typename Alloc >
+    friend class List;
   public:
     using this_t = Citerator< T >;
     Citerator();
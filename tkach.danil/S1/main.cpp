@@ -2,30 +2,29 @@
 #include <string>
 #include <cstddef>
 #include <limits>
+#include <utility>
+#include "lexer.hpp"
 #include "list.hpp"
 
 namespace
 {
   using pairs = std::pair< std::string, tkach::List< size_t > >;
+  using cursor = std::pair< tkach::Citerator< size_t >, size_t >;
 
   tkach::List< pairs > inputLists(std::istream& in)
   {
     tkach::List< pairs > fd_pair_list;
+    tkach::Lexer lexer(in);
     std::string list_name = "";
-    while (in >> list_name)
+    while (lexer.readWord(list_name))
     {
-      if (list_name.empty())
-      {
-        continue;
-      }
       tkach::List < size_t > temp_list;
       size_t num = 0;
-      while (in >> num)
+      while (lexer.readNumber(num))
       {
         temp_list.pushBack(num);
       }
-      fd_pair_list.pushBack(std::make_pair(list_name, temp_list));
-      in.clear();
+      fd_pair_list.emplaceBack(list_name, std::move(temp_list));
     }
     return fd_pair_list;
   }
@@ -41,42 +40,54 @@ namespace
 
   void outputListDataAndSums(std::ostream& out, const tkach::List< pairs >& list)
   {
-    tkach::List< pairs > fd_pair_list(list);
+    tkach::List< cursor > cursors;
+    auto pair_it = list.cbegin();
+    do
+    {
+      if (pair_it->second.empty())
+      {
+        cursors.emplaceBack(tkach::Citerator< size_t >(), 0);
+      }
+      else
+      {
+        cursors.emplaceBack(pair_it->second.cbegin(), pair_it->second.size());
+      }
+      pair_it++;
+    }
+    while (pair_it != list.cbegin());
     auto max = std::numeric_limits< size_t >::max();
     bool overflow = false;
     tkach::List< size_t > sums;
-    tkach::List< size_t > new_list;
-    new_list.pushFront(0);
-    while (!new_list.empty())
+    bool column_found = true;
+    while (column_found)
     {
-      new_list.clear();
+      column_found = false;
       size_t sum = 0;
-      auto it = fd_pair_list.begin();
+      auto it = cursors.begin();
       do
       {
-        if (it->second.empty())
-        {
-          it++;
-          continue;
-        }
-        size_t pair_second_front = it->second.front();
-        if (sum > max - pair_second_front)
+        if (it->second != 0)
         {
-          overflow = true;
+          size_t value = *(it->first);
+          if (sum > max - value)
+          {
+            overflow = true;
+          }
+          sum += value;
+          if (column_found)
+          {
+            out << " ";
+          }
+          out << value;
+          column_found = true;
+          ++(it->first);
+          --(it->second);
         }
-        sum += pair_second_front;
-        new_list.pushBack(pair_second_front);
-        it->second.popFront();
         it++;
       }
-      while (it != fd_pair_list.begin());
-      if (!new_list.empty())
+      while (it != cursors.begin());
+      if (column_found)
       {
-        out << new_list.front();
-        for (auto it = ++new_list.begin(); it != new_list.end(); ++it)
-        {
-          out << " " << *it;
-        }
         out << "\n";
         if (sum != 0)
         {
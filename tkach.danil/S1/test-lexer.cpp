@@ -0,0 +1,57 @@
+#include <boost/test/unit_test.hpp>
+#include <limits>
+#include <sstream>
+#include <string>
+#include "lexer.hpp"
+
+using namespace tkach;
+
+BOOST_AUTO_TEST_CASE(lexer_words_and_numbers_test)
+{
+  std::istringstream in("first 1 +2\t\n second 12a -1");
+  Lexer lexer(in);
+  std::string word;
+  size_t number = 0;
+  BOOST_TEST(lexer.readWord(word));
+  BOOST_TEST(word == "first");
+  BOOST_TEST(lexer.readNumber(number));
+  BOOST_TEST(number == 1);
+  BOOST_TEST(lexer.readNumber(number));
+  BOOST_TEST(number == 2);
+  BOOST_TEST(!lexer.readNumber(number));
+  BOOST_TEST(lexer.readWord(word));
+  BOOST_TEST(word == "second");
+  BOOST_TEST(lexer.readNumber(number));
+  BOOST_TEST(number == 12);
+  BOOST_TEST(!lexer.readNumber(number));
+  BOOST_TEST(lexer.readWord(word));
+  BOOST_TEST(word == "a");
+  BOOST_TEST(lexer.readNumber(number));
+  BOOST_TEST(number == std::numeric_limits< size_t >::max());
+  BOOST_TEST(!lexer.readNumber(number));
+  BOOST_TEST(!lexer.readWord(word));
+}
+
+BOOST_AUTO_TEST_CASE(lexer_overflow_test)
+{
+  std::istringstream in("18446744073709551616 7");
+  Lexer lexer(in);
+  size_t number = 0;
+  BOOST_TEST(!lexer.readNumber(number));
+  BOOST_TEST(lexer.readNumber(number));
+  BOOST_TEST(number == 7);
+}
+
+BOOST_AUTO_TEST_CASE(lexer_refill_test)
+{
+  std::string name(Lexer::initial_capacity + 3, 'x');
+  std::istringstream in("a " + name + " 42");
+  Lexer lexer(in);
+  std::string word;
+  size_t number = 0;
+  BOOST_TEST(lexer.readWord(word));
+  BOOST_TEST(lexer.readWord(word));
+  BOOST_TEST(word == name);
+  BOOST_TEST(lexer.readNumber(number));
+  BOOST_TEST(number == 42);
+}
@@ -1,11 +1,46 @@
 #include <boost/test/unit_test.hpp>
 #include <sstream>
+#include <string>
 #include "list.hpp"
 
 using namespace tkach;
 
 namespace
 {
+  template< typename T >
+  struct CountingAllocator
+  {
+    using value_type = T;
+    size_t* live;
+    explicit CountingAllocator(size_t& counter) noexcept:
+      live(std::addressof(counter))
+    {}
+    template< typename U >
+    CountingAllocator(const CountingAllocator< U >& other) noexcept:
+      live(other.live)
+    {}
+    T* allocate(size_t n)
+    {
+      ++*live;
+      return std::allocator< T >().allocate(n);
+    }
+    void deallocate(T* ptr, size_t n) noexcept
+    {
+      --*live;
+      std::allocator< T >().deallocate(ptr, n);
+    }
+    template< typename U >
+    bool operator==(const CountingAllocator< U >& rhs) const noexcept
+    {
+      return live == rhs.live;
+    }
+    template< typename U >
+    bool operator!=(const CountingAllocator< U >& rhs) const noexcept
+    {
+      return live != rhs.live;
+    }
+  };
+
   template< typename T >
   void outputList(std::ostream& out, const List< T >& list)
   {
@@ -586,3 +621,155 @@ BOOST_AUTO_TEST_CASE(list_begin_end_test)
   BOOST_TEST(*(list1.end()) == 1);
 }
 
+
+BOOST_AUTO_TEST_CASE(list_shared_pool_splice_test)
+{
+  List< int > list1;
+  list1.pushBack(1);
+  list1.pushBack(2);
+  List< int > list2(list1.getPool());
+  list2.pushBack(3);
+  list2.pushBack(4);
+  const int* moved = std::addressof(list2.front());
+  list1.spliceAfter(list1.cbegin(), list2);
+  BOOST_TEST(list2.empty());
+  BOOST_TEST(std::addressof(*(++list1.begin())) == moved);
+  std::ostringstream out;
+  outputList(out, list1);
+  BOOST_TEST(out.str() == "1 3 4 2");
+}
+
+BOOST_AUTO_TEST_CASE(list_foreign_pool_splice_test)
+{
+  List< std::string > list1;
+  list1.pushBack("a");
+  list1.pushBack("b");
+  {
+    List< std::string > list2;
+    list2.pushBack("c");
+    list2.pushBack("d");
+    list2.pushBack("e");
+    const std::string* moved = std::addressof(*(++list2.cbegin()));
+    list1.spliceAfter(list1.cbegin(), list2, list2.cbegin(), list2.cend());
+    BOOST_TEST(list2.size() == 1);
+    BOOST_TEST(list2.front() == "c");
+    BOOST_TEST(std::addressof(*(++list1.cbegin())) == moved);
+  }
+  std::ostringstream out;
+  outputList(out, list1);
+  BOOST_TEST(out.str() == "a d e b");
+  BOOST_TEST(list1.size() == 4);
+  List< std::string > list3;
+  list3.pushBack("f");
+  list3.pushBack("g");
+  list1.spliceAfter(std::next(list1.cbegin(), 3), list3, list3.cbegin(), list3.cend());
+  list1.pushBack("h");
+  std::ostringstream tail_out;
+  outputList(tail_out, list1);
+  BOOST_TEST(tail_out.str() == "a d e b g h");
+}
+
+BOOST_AUTO_TEST_CASE(list_merged_pool_test)
+{
+  List< int > list1;
+  for (int i = 0; i < 10; ++i)
+  {
+    list1.pushBack(i);
+  }
+  {
+    List< int > list3(list1.getPool());
+    list3.pushBack(10);
+    List< int > list2;
+    for (int i = 0; i < 10; ++i)
+    {
+      list2.pushBack(i);
+    }
+    list1.spliceAfter(list1.cbegin(), list2, list2.cbegin(), std::next(list2.cbegin(), 3));
+    list2.spliceAfter(list2.cbegin(), list1, list1.cbegin(), std::next(list1.cbegin(), 2));
+    BOOST_TEST(list1.size() == 11);
+    BOOST_TEST(list2.size() == 9);
+    BOOST_TEST(list1.getPool() == list2.getPool());
+    BOOST_TEST(list1.getPool()->slabCount() == 4);
+    BOOST_TEST(list3.front() == 10);
+  }
+  std::ostringstream out;
+  outputList(out, list1);
+  BOOST_TEST(out.str() == "0 2 1 2 3 4 5 6 7 8 9");
+  list1.clear();
+  BOOST_TEST(list1.empty());
+  BOOST_TEST(list1.getPool()->slabCount() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(list_bulk_clear_test)
+{
+  List< int > list;
+  for (int i = 0; i < 100; ++i)
+  {
+    list.pushBack(i);
+  }
+  BOOST_TEST(list.getPool()->slabCount() == 5);
+  list.clear();
+  BOOST_TEST(list.empty());
+  BOOST_TEST(list.getPool()->slabCount() == 0);
+  list.pushBack(1);
+  BOOST_TEST(list.front() == 1);
+  BOOST_TEST(list.size() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(list_short_list_test)
+{
+  size_t allocations = 0;
+  {
+    List< int, CountingAllocator< int > > list{CountingAllocator< int >(allocations)};
+    list.pushBack(1);
+    BOOST_TEST(allocations == 1);
+    const int* first = std::addressof(list.front());
+    list.pushBack(2);
+    BOOST_TEST(allocations == 3);
+    list.pushBack(3);
+    BOOST_TEST(allocations == 3);
+    BOOST_TEST(std::addressof(list.front()) == first);
+    BOOST_TEST(list.getPool()->slabCount() == 1);
+  }
+  BOOST_TEST(allocations == 0);
+}
+
+BOOST_AUTO_TEST_CASE(list_short_list_splice_test)
+{
+  List< std::string > list1;
+  list1.pushBack("a");
+  List< std::string > list2;
+  list2.pushBack("b");
+  list2.pushBack("c");
+  const std::string* moved = std::addressof(list2.front());
+  list1.spliceAfter(list1.cbegin(), list2);
+  BOOST_TEST(list2.empty());
+  BOOST_TEST(std::addressof(*(++list1.cbegin())) == moved);
+  List< std::string > list3;
+  list3.pushBack("d");
+  list3.pushBack("e");
+  list1.spliceAfter(list1.cbegin(), list3, list3.cbegin(), list3.cend());
+  list3.pushBack("f");
+  list1.clear();
+  std::ostringstream out;
+  outputList(out, list3);
+  BOOST_TEST(out.str() == "d f");
+}
+
+BOOST_AUTO_TEST_CASE(list_emplace_back_test)
+{
+  List< int > numbers;
+  numbers.pushBack(1);
+  numbers.pushBack(2);
+  const int* first = std::addressof(numbers.front());
+  List< std::pair< std::string, List< int > > > list;
+  list.emplaceBack("first", std::move(numbers));
+  list.emplaceBack("second", List< int >{3});
+  BOOST_TEST(numbers.empty());
+  BOOST_TEST(list.size() == 2);
+  BOOST_TEST(list.front().first == "first");
+  BOOST_TEST(std::addressof(list.front().second.front()) == first);
+  std::ostringstream out;
+  outputList(out, (++list.cbegin())->second);
+  BOOST_TEST(out.str() == "3");
+}
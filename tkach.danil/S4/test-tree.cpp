@@ -57,6 +57,28 @@ BOOST_AUTO_TEST_CASE(tree_erase_range_test)
   BOOST_TEST(out.str() == "2 second 3 third");
 }
 
+BOOST_AUTO_TEST_CASE(tree_erase_big_range_test)
+{
+  AvlTree< size_t, size_t > tree;
+  for (size_t i = 0; i < 1000; ++i)
+  {
+    tree.insert(std::make_pair(i, i));
+  }
+  auto it = tree.erase(tree.lowerBound(100), tree.lowerBound(900));
+  BOOST_TEST(it->first == 900);
+  BOOST_TEST(tree.size() == 200);
+  size_t expected = 0;
+  for (auto i = tree.cbegin(); i != tree.cend(); ++i)
+  {
+    BOOST_TEST(i->first == expected);
+    expected = (expected == 99) ? 900 : expected + 1;
+  }
+  BOOST_TEST((tree.erase(500) == tree.end()));
+  BOOST_TEST(tree.size() == 200);
+  tree.erase(tree.begin(), tree.end());
+  BOOST_TEST(tree.empty());
+}
+
 BOOST_AUTO_TEST_CASE(tree_insert_rvalue_test)
 {
   AvlTree< size_t, std::string > tree;
@@ -78,7 +78,9 @@ namespace tkach
     void fixHeight(TreeNode< Key, Value >* node);
     size_t height(TreeNode< Key, Value >* node);
     void swap(AvlTree< Key, Value, Cmp >& other) noexcept;
-    TreeNode< Key, Value >* eraseFrom(TreeNode< Key, Value >* root, const Key& key);
+    void eraseNode(TreeNode< Key, Value >* node);
+    void replaceNode(TreeNode< Key, Value >* node, TreeNode< Key, Value >* other);
+    void rebalanceFrom(TreeNode< Key, Value >* node);
     TreeNode< Key, Value >* balance(TreeNode< Key, Value >* root);
     template< class... Args >
     pair_t insertCmp(TreeNode< Key, Value >* root, const Key& key, Args&&... args);
@@ -215,42 +217,72 @@ namespace tkach
   }
 
   template< class Key, class Value, class Cmp >
-  TreeNode< Key, Value >* AvlTree< Key, Value, Cmp >::eraseFrom(TreeNode< Key, Value >* root, const Key& key)
+  void AvlTree< Key, Value, Cmp >::replaceNode(TreeNode< Key, Value >* node, TreeNode< Key, Value >* other)
   {
-    if (!root)
+    if (other)
     {
-      return nullptr;
+      other->parent = node->parent;
     }
-    if (cmp_(key, root->data.first))
+    if (!node->parent)
     {
-      root->left = eraseFrom(root->left, key);
+      root_ = other;
     }
-    else if (cmp_(root->data.first, key))
+    else if (node->parent->left == node)
     {
-      root->right = eraseFrom(root->right, key);
+      node->parent->left = other;
     }
     else
     {
-      if (root->left != nullptr)
+      node->parent->right = other;
+    }
+  }
+
+  template< class Key, class Value, class Cmp >
+  void AvlTree< Key, Value, Cmp >::eraseNode(TreeNode< Key, Value >* node)
+  {
+    TreeNode< Key, Value >* start = node->parent;
+    if (node->left && node->right)
+    {
+      TreeNode< Key, Value >* next = findMin(node->right);
+      start = next;
+      if (next->parent != node)
       {
-        TreeNode< Key, Value >* max_tree = findMax(root->left);
-        root->data = max_tree->data;
-        root->left = eraseFrom(root->left, max_tree->data.first);
+        start = next->parent;
+        replaceNode(next, next->right);
+        next->right = node->right;
+        next->right->parent = next;
       }
-      else if (root->right != nullptr)
+      next->left = node->left;
+      next->left->parent = next;
+      next->height = node->height;
+      replaceNode(node, next);
+    }
+    else
+    {
+      replaceNode(node, node->left ? node->left : node->right);
+    }
+    delete node;
+    rebalanceFrom(start);
+  }
+
+  template< class Key, class Value, class Cmp >
+  void AvlTree< Key, Value, Cmp >::rebalanceFrom(TreeNode< Key, Value >* node)
+  {
+    while (node)
+    {
+      size_t old_height = node->height;
+      fixHeight(node);
+      node = balance(node);
+      if (!node->parent)
       {
-        TreeNode< Key, Value >* min_tree = findMin(root->right);
-        root->data = min_tree->data;
-        root->right = eraseFrom(root->right, min_tree->data.first);
+        root_ = node;
       }
-      else
+      if (node->height == old_height)
       {
-        delete root;
-        return nullptr;
+        return;
       }
+      node = node->parent;
     }
-    fixHeight(root);
-    return balance(root);
   }
 
   template< class Key, class Value, class Cmp >
@@ -273,13 +305,16 @@ namespace tkach
   template< class Key, class Value, class Cmp >
   Iterator< Key, Value, Cmp > AvlTree< Key, Value, Cmp >::erase(Iterator< Key, Value, Cmp > begin, Iterator< Key, Value, Cmp > end)
   {
-    Iterator< Key, Value, Cmp > res;
+    if (begin == this->begin() && end == this->end())
+    {
+      clear();
+      return end;
+    }
     while (begin != end)
     {
-      res = erase(begin->first);
-      begin++;
+      begin = erase(begin);
     }
-    return res;
+    return end;
   }
 
   template< class Key, class Value, class Cmp >
@@ -305,7 +340,7 @@ namespace tkach
   {
     auto it2 = it;
     it2++;
-    root_ = eraseFrom(root_, it->first);
+    eraseNode(it.node_);
     size_--;
     return it2;
   }
@@ -314,11 +349,11 @@ namespace tkach
   Iterator< Key, Value, Cmp > AvlTree< Key, Value, Cmp >::erase(const Key& key)
   {
     auto it = find(key);
-    auto it2 = it;
-    it2++;
-    root_ = eraseFrom(root_, key);
-    size_--;
-    return it2;
+    if (it == end())
+    {
+      return it;
+    }
+    return erase(it);
   }
 
   template< class Key, class Value, class Cmp >
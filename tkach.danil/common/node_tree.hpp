@@ -25,7 +25,7 @@ namespace tkach
     parent(nullptr),
     right(nullptr),
     left(nullptr),
-    height(0)
+    height(1)
   {}
 }
 
@@ -3,11 +3,13 @@
 
 #include <cstddef>
 #include <iterator>
+#include <memory>
 #include <type_traits>
 #include <utility>
 
 #include "CircularFwdListIterators.hpp"
 #include "FwdListNode.hpp"
+#include "NodePool.hpp"
 
 namespace zholobov {
 
@@ -19,7 +21,7 @@ namespace zholobov {
             typename std::iterator_traits< T >::iterator_category >::value >;
   }
 
-  template < typename T >
+  template < typename T, typename Alloc = std::allocator< T > >
   class CircularFwdList {
   public:
     using value_type = T;
@@ -27,8 +29,10 @@ namespace zholobov {
     using const_reference = const value_type&;
     using iterator = CircularFwdListIterator< value_type >;
     using const_iterator = CircularFwdListConstIterator< value_type >;
+    using allocator_type = Alloc;
 
     CircularFwdList();
+    explicit CircularFwdList(const Alloc& alloc);
     explicit CircularFwdList(size_t n);
     CircularFwdList(size_t n, const value_type& val);
     CircularFwdList(std::initializer_list< value_type > init);
@@ -101,28 +105,52 @@ namespace zholobov {
     void clear() noexcept;
 
   private:
+    using node_type = FwdListNode< T >;
+    using node_allocator = typename std::allocator_traits< Alloc >::template rebind_alloc< node_type >;
+    using pool_type = NodePool< node_type, node_allocator >;
+
     FwdListNodeBase* before_head_;
     FwdListNodeBase* head_;
     FwdListNodeBase* tail_;
     size_t size_;
+    node_allocator alloc_;
+    std::shared_ptr< pool_type > pool_;
+
+    CircularFwdList(const node_allocator& alloc, const std::shared_ptr< pool_type >& pool);
+    node_type* create_node(value_type&& val, FwdListNodeBase* next_node);
+    void destroy_node(FwdListNodeBase* node) noexcept;
+    void adopt_nodes(pool_type& pool) noexcept;
+    void share_pool(CircularFwdList& other, FwdListNodeBase* first, size_t count) noexcept;
   };
 }
 
-template < typename T >
-zholobov::CircularFwdList< T >::CircularFwdList():
+template < typename T, typename Alloc >
+zholobov::CircularFwdList< T, Alloc >::CircularFwdList():
+  CircularFwdList(Alloc())
+{}
+
+template < typename T, typename Alloc >
+zholobov::CircularFwdList< T, Alloc >::CircularFwdList(const Alloc& alloc):
+  CircularFwdList(node_allocator(alloc), nullptr)
+{}
+
+template < typename T, typename Alloc >
+zholobov::CircularFwdList< T, Alloc >::CircularFwdList(const node_allocator& alloc, const std::shared_ptr< pool_type >& pool):
   before_head_(reinterpret_cast< FwdListNodeBase* >(std::addressof(head_))),
   head_(nullptr),
   tail_(nullptr),
-  size_(0)
+  size_(0),
+  alloc_(alloc),
+  pool_(pool)
 {}
 
-template < typename T >
-zholobov::CircularFwdList< T >::CircularFwdList(size_t n):
+template < typename T, typename Alloc >
+zholobov::CircularFwdList< T, Alloc >::CircularFwdList(size_t n):
   CircularFwdList(n, value_type())
 {}
 
-template < typename T >
-zholobov::CircularFwdList< T >::CircularFwdList(size_t n, const value_type& val):
+template < typename T, typename Alloc >
+zholobov::CircularFwdList< T, Alloc >::CircularFwdList(size_t n, const value_type& val):
   CircularFwdList()
 {
   for (size_t i = 0; i < n; ++i) {
@@ -130,55 +158,55 @@ zholobov::CircularFwdList< T >::CircularFwdList(size_t n, const value_type& val)
   }
 }
 
-template < typename T >
-zholobov::CircularFwdList< T >::CircularFwdList(std::initializer_list< value_type > init):
+template < typename T, typename Alloc >
+zholobov::CircularFwdList< T, Alloc >::CircularFwdList(std::initializer_list< value_type > init):
   CircularFwdList()
 {
   assign(init);
 }
 
-template < typename T >
-zholobov::CircularFwdList< T >::CircularFwdList(const CircularFwdList& other):
-  CircularFwdList()
+template < typename T, typename Alloc >
+zholobov::CircularFwdList< T, Alloc >::CircularFwdList(const CircularFwdList& other):
+  CircularFwdList(other.alloc_, nullptr)
 {
   for (const auto& elem: other) {
     push_back(elem);
   }
 }
 
-template < typename T >
-zholobov::CircularFwdList< T >::CircularFwdList(CircularFwdList&& other) noexcept:
-  CircularFwdList()
+template < typename T, typename Alloc >
+zholobov::CircularFwdList< T, Alloc >::CircularFwdList(CircularFwdList&& other) noexcept:
+  CircularFwdList(other.alloc_, nullptr)
 {
   swap(other);
 }
 
-template < typename T >
+template < typename T, typename Alloc >
 template < typename InputIter, typename SFINAE >
-zholobov::CircularFwdList< T >::CircularFwdList(InputIter first, InputIter last):
+zholobov::CircularFwdList< T, Alloc >::CircularFwdList(InputIter first, InputIter last):
   CircularFwdList()
 {
   assign(first, last);
 }
 
-template < typename T >
-zholobov::CircularFwdList< T >::~CircularFwdList()
+template < typename T, typename Alloc >
+zholobov::CircularFwdList< T, Alloc >::~CircularFwdList()
 {
   clear();
 }
 
-template < typename T >
-zholobov::CircularFwdList< T >& zholobov::CircularFwdList< T >::operator=(const CircularFwdList& other)
+template < typename T, typename Alloc >
+zholobov::CircularFwdList< T, Alloc >& zholobov::CircularFwdList< T, Alloc >::operator=(const CircularFwdList& other)
 {
   if (this != std::addressof(other)) {
-    CircularFwdList< T > temp(other);
+    CircularFwdList< T, Alloc > temp(other);
     swap(temp);
   }
   return *this;
 }
 
-template < typename T >
-zholobov::CircularFwdList< T >& zholobov::CircularFwdList< T >::operator=(CircularFwdList&& other) noexcept
+template < typename T, typename Alloc >
+zholobov::CircularFwdList< T, Alloc >& zholobov::CircularFwdList< T, Alloc >::operator=(CircularFwdList&& other) noexcept
 {
   if (this != std::addressof(other)) {
     clear();
@@ -187,135 +215,138 @@ zholobov::CircularFwdList< T >& zholobov::CircularFwdList< T >::operator=(Circul
   return *this;
 }
 
-template < typename T >
-zholobov::CircularFwdList< T >& zholobov::CircularFwdList< T >::operator=(std::initializer_list< value_type > init)
+template < typename T, typename Alloc >
+zholobov::CircularFwdList< T, Alloc >& zholobov::CircularFwdList< T, Alloc >::operator=(std::initializer_list< value_type > init)
 {
   assign(init);
   return *this;
 }
 
-template < typename T >
+template < typename T, typename Alloc >
 template < typename InputIter, typename SFINAE >
-void zholobov::CircularFwdList< T >::assign(InputIter first, InputIter last)
+void zholobov::CircularFwdList< T, Alloc >::assign(InputIter first, InputIter last)
 {
-  CircularFwdList< T > temp;
+  CircularFwdList< T, Alloc > temp(alloc_, nullptr);
   for (; first != last; ++first) {
     temp.push_back(*first);
   }
   swap(temp);
 }
 
-template < typename T >
-void zholobov::CircularFwdList< T >::assign(size_t n, const T& val)
+template < typename T, typename Alloc >
+void zholobov::CircularFwdList< T, Alloc >::assign(size_t n, const T& val)
 {
-  CircularFwdList< T > temp(n, val);
+  CircularFwdList< T, Alloc > temp(alloc_, nullptr);
+  for (size_t i = 0; i < n; ++i) {
+    temp.push_front(val);
+  }
   swap(temp);
 }
 
-template < typename T >
-void zholobov::CircularFwdList< T >::assign(std::initializer_list< T > init)
+template < typename T, typename Alloc >
+void zholobov::CircularFwdList< T, Alloc >::assign(std::initializer_list< T > init)
 {
-  CircularFwdList< T > temp;
+  CircularFwdList< T, Alloc > temp(alloc_, nullptr);
   for (const auto& elem: init) {
     temp.push_back(elem);
   }
   swap(temp);
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::iterator zholobov::CircularFwdList< T >::before_begin() noexcept
+template < typename T, typename Alloc >
+typename zholobov::CircularFwdList< T, Alloc >::iterator zholobov::CircularFwdList< T, Alloc >::before_begin() noexcept
 {
   return iterator(std::addressof(before_head_));
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::const_iterator zholobov::CircularFwdList< T >::before_begin() const noexcept
+template < typename T, typename Alloc >
+typename zholobov::CircularFwdList< T, Alloc >::const_iterator zholobov::CircularFwdList< T, Alloc >::before_begin() const noexcept
 {
   return cbefore_begin();
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::iterator zholobov::CircularFwdList< T >::begin() noexcept
+template < typename T, typename Alloc >
+typename zholobov::CircularFwdList< T, Alloc >::iterator zholobov::CircularFwdList< T, Alloc >::begin() noexcept
 {
   return iterator(std::addressof(head_));
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::const_iterator zholobov::CircularFwdList< T >::begin() const noexcept
+template < typename T, typename Alloc >
+typename zholobov::CircularFwdList< T, Alloc >::const_iterator zholobov::CircularFwdList< T, Alloc >::begin() const noexcept
 {
   return cbegin();
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::const_iterator zholobov::CircularFwdList< T >::cbefore_begin() const noexcept
+template < typename T, typename Alloc >
+typename zholobov::CircularFwdList< T, Alloc >::const_iterator zholobov::CircularFwdList< T, Alloc >::cbefore_begin() const noexcept
 {
   return const_iterator(std::addressof(before_head_));
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::const_iterator zholobov::CircularFwdList< T >::cbegin() const noexcept
+template < typename T, typename Alloc >
+typename zholobov::CircularFwdList< T, Alloc >::const_iterator zholobov::CircularFwdList< T, Alloc >::cbegin() const noexcept
 {
   return const_iterator(std::addressof(head_));
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::iterator zholobov::CircularFwdList< T >::end() noexcept
+template < typename T, typename Alloc >
+typename zholobov::CircularFwdList< T, Alloc >::iterator zholobov::CircularFwdList< T, Alloc >::end() noexcept
 {
   return (size_ == 0) ? iterator(std::addressof(head_)) : iterator(std::addressof(tail_->next));
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::const_iterator zholobov::CircularFwdList< T >::end() const noexcept
+template < typename T, typename Alloc >
+typename zholobov::CircularFwdList< T, Alloc >::const_iterator zholobov::CircularFwdList< T, Alloc >::end() const noexcept
 {
   return cend();
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::const_iterator zholobov::CircularFwdList< T >::cend() const noexcept
+template < typename T, typename Alloc >
+typename zholobov::CircularFwdList< T, Alloc >::const_iterator zholobov::CircularFwdList< T, Alloc >::cend() const noexcept
 {
   return (size_ == 0) ? const_iterator(std::addressof(head_)) : const_iterator(std::addressof(tail_->next));
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::reference zholobov::CircularFwdList< T >::front()
+template < typename T, typename Alloc >
+typename zholobov::CircularFwdList< T, Alloc >::reference zholobov::CircularFwdList< T, Alloc >::front()
 {
   return static_cast< FwdListNode< T >* >(head_)->value;
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::const_reference zholobov::CircularFwdList< T >::front() const
+template < typename T, typename Alloc >
+typename zholobov::CircularFwdList< T, Alloc >::const_reference zholobov::CircularFwdList< T, Alloc >::front() const
 {
   return static_cast< FwdListNode< T >* >(head_)->value;
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::reference zholobov::CircularFwdList< T >::back()
+template < typename T, typename Alloc >
+typename zholobov::CircularFwdList< T, Alloc >::reference zholobov::CircularFwdList< T, Alloc >::back()
 {
   return static_cast< FwdListNode< T >* >(tail_)->value;
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::const_reference zholobov::CircularFwdList< T >::back() const
+template < typename T, typename Alloc >
+typename zholobov::CircularFwdList< T, Alloc >::const_reference zholobov::CircularFwdList< T, Alloc >::back() const
 {
   return static_cast< FwdListNode< T >* >(tail_)->value;
 }
 
-template < typename T >
-bool zholobov::CircularFwdList< T >::empty() const noexcept
+template < typename T, typename Alloc >
+bool zholobov::CircularFwdList< T, Alloc >::empty() const noexcept
 {
   return size_ == 0;
 }
 
-template < typename T >
-void zholobov::CircularFwdList< T >::push_front(const value_type& val)
+template < typename T, typename Alloc >
+void zholobov::CircularFwdList< T, Alloc >::push_front(const value_type& val)
 {
   push_front(value_type(val));
 }
 
-template < typename T >
-void zholobov::CircularFwdList< T >::push_front(value_type&& val)
+template < typename T, typename Alloc >
+void zholobov::CircularFwdList< T, Alloc >::push_front(value_type&& val)
 {
-  auto new_node = new FwdListNode< value_type >(std::move(val), head_);
+  auto new_node = create_node(std::move(val), head_);
   head_ = new_node;
   if (size_ == 0) {
     tail_ = head_;
@@ -324,16 +355,16 @@ void zholobov::CircularFwdList< T >::push_front(value_type&& val)
   ++size_;
 }
 
-template < typename T >
-void zholobov::CircularFwdList< T >::push_back(const value_type& val)
+template < typename T, typename Alloc >
+void zholobov::CircularFwdList< T, Alloc >::push_back(const value_type& val)
 {
   push_back(value_type(val));
 }
 
-template < typename T >
-void zholobov::CircularFwdList< T >::push_back(value_type&& val)
+template < typename T, typename Alloc >
+void zholobov::CircularFwdList< T, Alloc >::push_back(value_type&& val)
 {
-  auto new_node = new FwdListNode< value_type >(std::move(val), head_);
+  auto new_node = create_node(std::move(val), head_);
   if (size_ == 0) {
     head_ = new_node;
     head_->next = head_;
@@ -344,8 +375,8 @@ void zholobov::CircularFwdList< T >::push_back(value_type&& val)
   ++size_;
 }
 
-template < typename T >
-void zholobov::CircularFwdList< T >::pop_front()
+template < typename T, typename Alloc >
+void zholobov::CircularFwdList< T, Alloc >::pop_front()
 {
   FwdListNodeBase* temp = head_;
   if (size_ == 0) {
@@ -357,66 +388,76 @@ void zholobov::CircularFwdList< T >::pop_front()
     head_ = head_->next;
     tail_->next = head_;
   }
-  delete temp;
+  destroy_node(temp);
   --size_;
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::iterator
-zholobov::CircularFwdList< T >::insert_after(const_iterator position, const T& x)
+template < typename T, typename Alloc >
+typename zholobov::CircularFwdList< T, Alloc >::iterator
+zholobov::CircularFwdList< T, Alloc >::insert_after(const_iterator position, const T& x)
 {
-  CircularFwdList< T > list(1, x);
+  CircularFwdList< T, Alloc > list(alloc_, pool_);
+  list.push_back(x);
   splice_after(position, list);
   return ++iterator(position);
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::iterator
-zholobov::CircularFwdList< T >::insert_after(const_iterator position, T&& x)
+template < typename T, typename Alloc >
+typename zholobov::CircularFwdList< T, Alloc >::iterator
+zholobov::CircularFwdList< T, Alloc >::insert_after(const_iterator position, T&& x)
 {
-  CircularFwdList< T > list;
+  CircularFwdList< T, Alloc > list(alloc_, pool_);
   list.push_back(std::move(x));
   splice_after(position, list);
   return ++iterator(position);
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::iterator
-zholobov::CircularFwdList< T >::insert_after(const_iterator position, size_t n, const T& x)
+template < typename T, typename Alloc >
+typename zholobov::CircularFwdList< T, Alloc >::iterator
+zholobov::CircularFwdList< T, Alloc >::insert_after(const_iterator position, size_t n, const T& x)
 {
-  CircularFwdList< T > list(n, x);
+  CircularFwdList< T, Alloc > list(alloc_, pool_);
+  for (size_t i = 0; i < n; ++i) {
+    list.push_front(x);
+  }
   splice_after(position, list);
   auto result = iterator(position);
   std::advance(result, n);
   return result;
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::iterator
-zholobov::CircularFwdList< T >::insert_after(const_iterator position, std::initializer_list< T > il)
+template < typename T, typename Alloc >
+typename zholobov::CircularFwdList< T, Alloc >::iterator
+zholobov::CircularFwdList< T, Alloc >::insert_after(const_iterator position, std::initializer_list< T > il)
 {
-  CircularFwdList< T > list(il);
+  CircularFwdList< T, Alloc > list(alloc_, pool_);
+  for (const auto& elem: il) {
+    list.push_back(elem);
+  }
   splice_after(position, list);
   auto result = iterator(position);
   std::advance(result, il.size());
   return result;
 }
 
-template < typename T >
+template < typename T, typename Alloc >
 template < class InputIter, typename SFINAE >
-typename zholobov::CircularFwdList< T >::iterator
-zholobov::CircularFwdList< T >::insert_after(const_iterator position, InputIter first, InputIter last)
+typename zholobov::CircularFwdList< T, Alloc >::iterator
+zholobov::CircularFwdList< T, Alloc >::insert_after(const_iterator position, InputIter first, InputIter last)
 {
-  CircularFwdList< T > list(first, last);
+  CircularFwdList< T, Alloc > list(alloc_, pool_);
+  for (auto it = first; it != last; ++it) {
+    list.push_back(*it);
+  }
   splice_after(position, list);
   auto result = iterator(position);
   std::advance(result, std::distance(first, last));
   return result;
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::iterator
-zholobov::CircularFwdList< T >::erase_after(const_iterator position)
+template < typename T, typename Alloc >
+typename zholobov::CircularFwdList< T, Alloc >::iterator
+zholobov::CircularFwdList< T, Alloc >::erase_after(const_iterator position)
 {
   auto last = position;
   if (++last == cend()) {
@@ -426,26 +467,26 @@ zholobov::CircularFwdList< T >::erase_after(const_iterator position)
   return erase_after(position, last);
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::iterator
-zholobov::CircularFwdList< T >::erase_after(const_iterator position, const_iterator last)
+template < typename T, typename Alloc >
+typename zholobov::CircularFwdList< T, Alloc >::iterator
+zholobov::CircularFwdList< T, Alloc >::erase_after(const_iterator position, const_iterator last)
 {
-  CircularFwdList< T > tmp;
+  CircularFwdList< T, Alloc > tmp(alloc_, pool_);
   tmp.splice_after(tmp.cbefore_begin(), *this, position, last);
   return ++iterator(position);
 }
 
-template < typename T >
-void zholobov::CircularFwdList< T >::remove(const value_type& val)
+template < typename T, typename Alloc >
+void zholobov::CircularFwdList< T, Alloc >::remove(const value_type& val)
 {
   remove_if([&val](const T& value) {
     return value == val;
   });
 }
 
-template < typename T >
+template < typename T, typename Alloc >
 template < class Predicate >
-void zholobov::CircularFwdList< T >::remove_if(Predicate pred)
+void zholobov::CircularFwdList< T, Alloc >::remove_if(Predicate pred)
 {
   while (head_ != nullptr && (pred(static_cast< FwdListNode< T >* >(head_)->value))) {
     pop_front();
@@ -459,7 +500,7 @@ void zholobov::CircularFwdList< T >::remove_if(Predicate pred)
         if (temp == tail_) {
           tail_ = p;
         }
-        delete temp;
+        destroy_node(temp);
         --size_;
       } else {
         p = p->next;
@@ -468,11 +509,11 @@ void zholobov::CircularFwdList< T >::remove_if(Predicate pred)
   }
 }
 
-template < typename T >
+template < typename T, typename Alloc >
 template < typename List >
-void zholobov::CircularFwdList< T >::splice_after(const_iterator pos, List&& other)
+void zholobov::CircularFwdList< T, Alloc >::splice_after(const_iterator pos, List&& other)
 {
-  static_assert(std::is_same< std::decay_t< List >, CircularFwdList< T > >::value, "Invalid list type");
+  static_assert(std::is_same< std::decay_t< List >, CircularFwdList< T, Alloc > >::value, "Invalid list type");
   if (!other.empty()) {
     FwdListNodeBase* p = before_head_;
     const_iterator it = cbefore_begin();
@@ -481,6 +522,7 @@ void zholobov::CircularFwdList< T >::splice_after(const_iterator pos, List&& oth
       p = p->next;
     }
     if (it != cend()) {
+      share_pool(other, other.head_, other.size_);
       other.tail_->next = p->next;
       p->next = other.head_;
       if (p == tail_) {
@@ -495,11 +537,11 @@ void zholobov::CircularFwdList< T >::splice_after(const_iterator pos, List&& oth
   }
 }
 
-template < typename T >
+template < typename T, typename Alloc >
 template < typename List >
-void zholobov::CircularFwdList< T >::splice_after(const_iterator pos, List&& other, const_iterator it)
+void zholobov::CircularFwdList< T, Alloc >::splice_after(const_iterator pos, List&& other, const_iterator it)
 {
-  static_assert(std::is_same< std::decay_t< List >, CircularFwdList< T > >::value, "Invalid list type");
+  static_assert(std::is_same< std::decay_t< List >, CircularFwdList< T, Alloc > >::value, "Invalid list type");
   FwdListNodeBase* p = before_head_;
   const_iterator this_it = cbefore_begin();
   while ((this_it != cend()) && (this_it != pos)) {
@@ -514,6 +556,7 @@ void zholobov::CircularFwdList< T >::splice_after(const_iterator pos, List&& oth
       other_p = std::addressof((*other_p)->next);
     }
     FwdListNodeBase* tmp = *other_p;
+    share_pool(other, tmp, 1);
     *other_p = tmp->next;
     tmp->next = p->next;
     p->next = tmp;
@@ -522,17 +565,18 @@ void zholobov::CircularFwdList< T >::splice_after(const_iterator pos, List&& oth
   }
 }
 
-template < typename T >
+template < typename T, typename Alloc >
 template < typename List >
-void zholobov::CircularFwdList< T >::splice_after(const_iterator pos, List&& other, const_iterator first, const_iterator last)
+void zholobov::CircularFwdList< T, Alloc >::splice_after(const_iterator pos, List&& other, const_iterator first, const_iterator last)
 {
-  static_assert(std::is_same< std::decay_t< List >, CircularFwdList< T > >::value, "Invalid list type");
+  static_assert(std::is_same< std::decay_t< List >, CircularFwdList< T, Alloc > >::value, "Invalid list type");
   FwdListNodeBase** pos_p = pos.node_;
   FwdListNodeBase** first_p = first.node_;
   FwdListNodeBase** last_p = last.node_;
 
   size_t count = std::distance(first, last) - 1;
   if (count > 0) {
+    share_pool(other, (*first_p)->next, count);
     if (last == other.cend()) {
       other.tail_ = *first_p;
     }
@@ -559,23 +603,27 @@ void zholobov::CircularFwdList< T >::splice_after(const_iterator pos, List&& oth
   }
 }
 
-template < typename T >
-void zholobov::CircularFwdList< T >::swap(CircularFwdList& other) noexcept
+template < typename T, typename Alloc >
+void zholobov::CircularFwdList< T, Alloc >::swap(CircularFwdList& other) noexcept
 {
   std::swap(head_, other.head_);
   std::swap(tail_, other.tail_);
   std::swap(size_, other.size_);
+  std::swap(alloc_, other.alloc_);
+  std::swap(pool_, other.pool_);
 }
 
-template < typename T >
-void zholobov::CircularFwdList< T >::clear() noexcept
+template < typename T, typename Alloc >
+void zholobov::CircularFwdList< T, Alloc >::clear() noexcept
 {
-  if (size_ != 0) {
+  if (std::is_trivially_destructible< T >::value && pool_.use_count() == 1 && !pool_->merged()) {
+    pool_->release();
+  } else if (size_ != 0) {
     FwdListNodeBase* curr = head_;
     do {
       FwdListNodeBase* temp = curr;
       curr = curr->next;
-      delete static_cast< FwdListNode< T >* >(temp);
+      destroy_node(temp);
     } while (curr != head_);
   }
   head_ = nullptr;
@@ -583,4 +631,75 @@ void zholobov::CircularFwdList< T >::clear() noexcept
   size_ = 0;
 }
 
+template < typename T, typename Alloc >
+typename zholobov::CircularFwdList< T, Alloc >::node_type*
+zholobov::CircularFwdList< T, Alloc >::create_node(value_type&& val, FwdListNodeBase* next_node)
+{
+  node_type* place = nullptr;
+  if (!pool_ && (size_ == 0)) {
+    place = pool_type::allocate_single(alloc_);
+  } else {
+    if (!pool_) {
+      pool_ = std::allocate_shared< pool_type >(alloc_, alloc_);
+      adopt_nodes(*pool_);
+    }
+    place = pool_->allocate();
+  }
+  try {
+    return new (place) node_type(std::move(val), next_node);
+  } catch (...) {
+    if (pool_) {
+      pool_->deallocate(place);
+    } else {
+      pool_type::deallocate_single(alloc_, place);
+    }
+    throw;
+  }
+}
+
+template < typename T, typename Alloc >
+void zholobov::CircularFwdList< T, Alloc >::destroy_node(FwdListNodeBase* node) noexcept
+{
+  node_type* value_node = static_cast< node_type* >(node);
+  value_node->~node_type();
+  if (pool_) {
+    pool_->deallocate(value_node);
+  } else {
+    pool_type::deallocate_single(alloc_, value_node);
+  }
+}
+
+template < typename T, typename Alloc >
+void zholobov::CircularFwdList< T, Alloc >::adopt_nodes(pool_type& pool) noexcept
+{
+  FwdListNodeBase* node = head_;
+  for (size_t i = 0; i < size_; ++i) {
+    pool.adopt(static_cast< node_type* >(node));
+    node = node->next;
+  }
+}
+
+template < typename T, typename Alloc >
+void zholobov::CircularFwdList< T, Alloc >::share_pool(CircularFwdList& other, FwdListNodeBase* first, size_t count) noexcept
+{
+  if (pool_ == other.pool_) {
+    return;
+  }
+  if (!other.pool_) {
+    if (pool_) {
+      for (size_t i = 0; i < count; ++i) {
+        pool_->adopt(static_cast< node_type* >(first));
+        first = first->next;
+      }
+    }
+    return;
+  }
+  if (!pool_) {
+    adopt_nodes(*other.pool_);
+    pool_ = other.pool_;
+    return;
+  }
+  pool_type::merge(pool_, other.pool_);
+}
+
 #endif
@@ -7,7 +7,7 @@
 
 namespace zholobov {
 
-  template < typename T >
+  template < typename T, typename Alloc >
   class CircularFwdList;
 
   template < typename T >
@@ -35,7 +35,8 @@ namespace zholobov {
     explicit CircularFwdListIterator(FwdListNodeBase** node);
     FwdListNodeBase** node_;
 
-    friend class CircularFwdList< T >;
+    template < typename U, typename Alloc >
+    friend class CircularFwdList;
     friend class CircularFwdListConstIterator< T >;
   };
 
@@ -61,7 +62,8 @@ namespace zholobov {
     explicit CircularFwdListConstIterator(FwdListNodeBase* const* node);
     FwdListNodeBase** node_;
 
-    friend class CircularFwdList< T >;
+    template < typename U, typename Alloc >
+    friend class CircularFwdList;
     friend class CircularFwdListIterator< T >;
   };
 
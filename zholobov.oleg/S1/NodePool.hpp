@@ -0,0 +1,284 @@
+#ifndef NODEPOOL_HPP
+#define NODEPOOL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace zholobov {
+
+  template < typename T, typename Alloc = std::allocator< T > >
+  class NodePool {
+  public:
+    using allocator_type = Alloc;
+
+    explicit NodePool(const Alloc& alloc = Alloc()) noexcept;
+    NodePool(const NodePool&) = delete;
+    ~NodePool();
+
+    NodePool& operator=(const NodePool&) = delete;
+
+    T* allocate();
+    void deallocate(T* ptr) noexcept;
+    void adopt(T* single) noexcept;
+    void release() noexcept;
+    size_t slab_count() const noexcept;
+    bool merged() const noexcept;
+
+    static T* allocate_single(const Alloc& alloc);
+    static void deallocate_single(const Alloc& alloc, T* single) noexcept;
+    static void merge(std::shared_ptr< NodePool >& lhs, std::shared_ptr< NodePool >& rhs) noexcept;
+
+  private:
+    union Cell;
+    struct Slab {
+      Cell* next;
+      size_t size;
+    };
+    union Cell {
+      Cell* next;
+      Slab slab;
+      typename std::aligned_storage< sizeof(T), alignof(T) >::type storage;
+    };
+    struct Single {
+      typename std::aligned_storage< sizeof(T), alignof(T) >::type storage;
+      Single* next;
+    };
+    using cell_allocator = typename std::allocator_traits< Alloc >::template rebind_alloc< Cell >;
+    using cell_traits = std::allocator_traits< cell_allocator >;
+    using single_allocator = typename std::allocator_traits< Alloc >::template rebind_alloc< Single >;
+    using single_traits = std::allocator_traits< single_allocator >;
+
+    static constexpr size_t min_slab_size = 4;
+    static constexpr size_t max_slab_size = 1024;
+
+    cell_allocator alloc_;
+    Cell* slabs_;
+    Cell* last_slab_;
+    Single* singles_;
+    Single* last_single_;
+    Cell* free_;
+    Cell* free_tail_;
+    Cell* bump_;
+    Cell* bump_end_;
+    size_t next_slab_size_;
+    size_t slab_count_;
+    std::shared_ptr< NodePool > target_;
+
+    void add_slab();
+    void absorb(NodePool& other) noexcept;
+    static std::shared_ptr< NodePool > root(std::shared_ptr< NodePool > pool) noexcept;
+  };
+
+}
+
+template < typename T, typename Alloc >
+zholobov::NodePool< T, Alloc >::NodePool(const Alloc& alloc) noexcept:
+  alloc_(alloc),
+  slabs_(nullptr),
+  last_slab_(nullptr),
+  singles_(nullptr),
+  last_single_(nullptr),
+  free_(nullptr),
+  free_tail_(nullptr),
+  bump_(nullptr),
+  bump_end_(nullptr),
+  next_slab_size_(min_slab_size),
+  slab_count_(0),
+  target_()
+{}
+
+template < typename T, typename Alloc >
+zholobov::NodePool< T, Alloc >::~NodePool()
+{
+  release();
+}
+
+template < typename T, typename Alloc >
+T* zholobov::NodePool< T, Alloc >::allocate()
+{
+  if (target_) {
+    return target_->allocate();
+  }
+  if (free_ != nullptr) {
+    Cell* cell = free_;
+    free_ = cell->next;
+    if (free_ == nullptr) {
+      free_tail_ = nullptr;
+    }
+    return reinterpret_cast< T* >(cell);
+  }
+  if (bump_ == bump_end_) {
+    add_slab();
+  }
+  return reinterpret_cast< T* >(bump_++);
+}
+
+template < typename T, typename Alloc >
+void zholobov::NodePool< T, Alloc >::deallocate(T* ptr) noexcept
+{
+  if (target_) {
+    target_->deallocate(ptr);
+    return;
+  }
+  Cell* cell = reinterpret_cast< Cell* >(ptr);
+  if (free_ == nullptr) {
+    free_tail_ = cell;
+  }
+  cell->next = free_;
+  free_ = cell;
+}
+
+template < typename T, typename Alloc >
+void zholobov::NodePool< T, Alloc >::adopt(T* single) noexcept
+{
+  if (target_) {
+    target_->adopt(single);
+    return;
+  }
+  Single* block = reinterpret_cast< Single* >(single);
+  block->next = singles_;
+  if (singles_ == nullptr) {
+    last_single_ = block;
+  }
+  singles_ = block;
+}
+
+template < typename T, typename Alloc >
+void zholobov::NodePool< T, Alloc >::release() noexcept
+{
+  while (slabs_ != nullptr) {
+    Cell* next = slabs_->slab.next;
+    cell_traits::deallocate(alloc_, slabs_, slabs_->slab.size + 1);
+    slabs_ = next;
+  }
+  single_allocator singles(alloc_);
+  while (singles_ != nullptr) {
+    Single* next = singles_->next;
+    single_traits::deallocate(singles, singles_, 1);
+    singles_ = next;
+  }
+  last_slab_ = nullptr;
+  last_single_ = nullptr;
+  free_ = nullptr;
+  free_tail_ = nullptr;
+  bump_ = nullptr;
+  bump_end_ = nullptr;
+  next_slab_size_ = min_slab_size;
+  slab_count_ = 0;
+}
+
+template < typename T, typename Alloc >
+size_t zholobov::NodePool< T, Alloc >::slab_count() const noexcept
+{
+  return target_ ? target_->slab_count() : slab_count_;
+}
+
+template < typename T, typename Alloc >
+bool zholobov::NodePool< T, Alloc >::merged() const noexcept
+{
+  return static_cast< bool >(target_);
+}
+
+template < typename T, typename Alloc >
+T* zholobov::NodePool< T, Alloc >::allocate_single(const Alloc& alloc)
+{
+  single_allocator singles(alloc);
+  return reinterpret_cast< T* >(single_traits::allocate(singles, 1));
+}
+
+template < typename T, typename Alloc >
+void zholobov::NodePool< T, Alloc >::deallocate_single(const Alloc& alloc, T* single) noexcept
+{
+  single_allocator singles(alloc);
+  single_traits::deallocate(singles, reinterpret_cast< Single* >(single), 1);
+}
+
+template < typename T, typename Alloc >
+void zholobov::NodePool< T, Alloc >::merge(std::shared_ptr< NodePool >& lhs, std::shared_ptr< NodePool >& rhs) noexcept
+{
+  lhs = root(std::move(lhs));
+  rhs = root(std::move(rhs));
+  if (lhs == rhs) {
+    return;
+  }
+  lhs->absorb(*rhs);
+  rhs->target_ = lhs;
+  rhs = lhs;
+}
+
+template < typename T, typename Alloc >
+std::shared_ptr< zholobov::NodePool< T, Alloc > > zholobov::NodePool< T, Alloc >::root(std::shared_ptr< NodePool > pool) noexcept
+{
+  while (pool->target_) {
+    pool = pool->target_;
+  }
+  return pool;
+}
+
+template < typename T, typename Alloc >
+void zholobov::NodePool< T, Alloc >::absorb(NodePool& other) noexcept
+{
+  if (other.slabs_ != nullptr) {
+    other.last_slab_->slab.next = slabs_;
+    slabs_ = other.slabs_;
+    if (last_slab_ == nullptr) {
+      last_slab_ = other.last_slab_;
+    }
+  }
+  if (other.singles_ != nullptr) {
+    other.last_single_->next = singles_;
+    singles_ = other.singles_;
+    if (last_single_ == nullptr) {
+      last_single_ = other.last_single_;
+    }
+  }
+  if (other.free_ != nullptr) {
+    other.free_tail_->next = free_;
+    free_ = other.free_;
+    if (free_tail_ == nullptr) {
+      free_tail_ = other.free_tail_;
+    }
+  }
+  if (bump_end_ - bump_ < other.bump_end_ - other.bump_) {
+    std::swap(bump_, other.bump_);
+    std::swap(bump_end_, other.bump_end_);
+  }
+  while (other.bump_ != other.bump_end_) {
+    deallocate(reinterpret_cast< T* >(other.bump_++));
+  }
+  if (next_slab_size_ < other.next_slab_size_) {
+    next_slab_size_ = other.next_slab_size_;
+  }
+  slab_count_ += other.slab_count_;
+  other.slabs_ = nullptr;
+  other.last_slab_ = nullptr;
+  other.singles_ = nullptr;
+  other.last_single_ = nullptr;
+  other.free_ = nullptr;
+  other.free_tail_ = nullptr;
+  other.bump_ = nullptr;
+  other.bump_end_ = nullptr;
+  other.slab_count_ = 0;
+}
+
+template < typename T, typename Alloc >
+void zholobov::NodePool< T, Alloc >::add_slab()
+{
+  Cell* slab = cell_traits::allocate(alloc_, next_slab_size_ + 1);
+  slab->slab.next = slabs_;
+  slab->slab.size = next_slab_size_;
+  if (slabs_ == nullptr) {
+    last_slab_ = slab;
+  }
+  slabs_ = slab;
+  bump_ = slab + 1;
+  bump_end_ = bump_ + next_slab_size_;
+  if (next_slab_size_ < max_slab_size) {
+    next_slab_size_ *= 2;
+  }
+  ++slab_count_;
+}
+
+#endif
@@ -1,11 +1,12 @@
 #include <boost/test/unit_test.hpp>
 
+#include <memory>
 #include <sstream>
 
 #include "CircularFwdList.hpp"
 
-template < typename T >
-std::string to_string(const zholobov::CircularFwdList< T >& list)
+template < typename T, typename Alloc >
+std::string to_string(const zholobov::CircularFwdList< T, Alloc >& list)
 {
   std::stringstream ss;
   if (list.size() != 0) {
@@ -18,6 +19,46 @@ std::string to_string(const zholobov::CircularFwdList< T >& list)
   return ss.str();
 }
 
+template < typename T >
+struct CountingAllocator {
+  using value_type = T;
+
+  explicit CountingAllocator(size_t& counter) noexcept:
+    live(std::addressof(counter))
+  {}
+
+  template < typename U >
+  CountingAllocator(const CountingAllocator< U >& other) noexcept:
+    live(other.live)
+  {}
+
+  T* allocate(size_t n)
+  {
+    ++*live;
+    return std::allocator< T >().allocate(n);
+  }
+
+  void deallocate(T* ptr, size_t n) noexcept
+  {
+    --*live;
+    std::allocator< T >().deallocate(ptr, n);
+  }
+
+  template < typename U >
+  bool operator==(const CountingAllocator< U >& other) const noexcept
+  {
+    return live == other.live;
+  }
+
+  template < typename U >
+  bool operator!=(const CountingAllocator< U >& other) const noexcept
+  {
+    return live != other.live;
+  }
+
+  size_t* live;
+};
+
 BOOST_AUTO_TEST_SUITE(CircularFwsList_Constructors)
 
 BOOST_AUTO_TEST_CASE(default_ctor)
@@ -501,3 +542,60 @@ BOOST_AUTO_TEST_CASE(splice_after)
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(CircularFwsList_Allocator)
+
+BOOST_AUTO_TEST_CASE(node_pool)
+{
+  using CountedList = zholobov::CircularFwdList< int, CountingAllocator< int > >;
+  size_t allocations = 0;
+  CountingAllocator< int > alloc(allocations);
+  {
+    CountedList list1(alloc);
+    list1.push_back(1);
+    BOOST_TEST(allocations == 1);
+    list1.push_back(2);
+    BOOST_TEST(allocations == 3);
+    list1.push_back(3);
+    BOOST_TEST(allocations == 3);
+
+    CountedList list2(alloc);
+    list2.push_back(4);
+    list1.splice_after(list1.cbegin(), list2);
+    BOOST_TEST(to_string(list1) == "1 4 2 3");
+    BOOST_TEST(allocations == 4);
+
+    list1.insert_after(list1.cbegin(), 5);
+    list1.erase_after(list1.cbegin());
+    list1.insert_after(list1.cbegin(), 6);
+    BOOST_TEST(to_string(list1) == "1 6 4 2 3");
+    BOOST_TEST(allocations == 4);
+
+    CountedList list3(alloc);
+    list3.push_back(7);
+    list3.push_back(8);
+    BOOST_TEST(allocations == 7);
+    list3.splice_after(list3.cbegin(), list1, list1.cbegin(), list1.cend());
+    BOOST_TEST(to_string(list3) == "7 6 4 2 3 8");
+    BOOST_TEST(to_string(list1) == "1");
+    BOOST_TEST(allocations == 6);
+    list1.clear();
+    list3.clear();
+    BOOST_TEST(list3.empty());
+  }
+  BOOST_TEST(allocations == 0);
+
+  {
+    CountedList list(alloc);
+    for (int i = 0; i < 100; ++i) {
+      list.push_back(i);
+    }
+    list.clear();
+    BOOST_TEST(allocations == 1);
+    list.push_back(1);
+    BOOST_TEST(list.front() == 1);
+  }
+  BOOST_TEST(allocations == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()